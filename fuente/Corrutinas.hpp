@@ -0,0 +1,233 @@
+#ifndef CORRUTINAS_HPP
+#define CORRUTINAS_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <conceptos.hpp>
+#include "Opcion.hpp"
+#include "Resultado.hpp"
+
+// `Retorno<R>` depende de que la conversión del objeto de retorno se haga al volver de
+// la corrutina, no antes de empezarla. Apple Clang 16 corresponde a Clang 17.
+#if defined(__clang__) && ((defined(__apple_build_version__) && __clang_major__ < 16) || (!defined(__apple_build_version__) && __clang_major__ < 17))
+#error "Corrutinas.hpp requiere GCC, MSVC o Clang 17 o posterior"
+#endif
+
+namespace cor { // Declaración
+    /**
+    * @brief Pila de marcos de corrutina, una por hilo.
+    *
+    * Las corrutinas que devuelven `Opcion` o `Resultado` nunca se suspenden
+    * realmente: corren hasta el final dentro de la llamada, o se destruyen al
+    * propagar un error. Sus marcos se crean y destruyen en orden LIFO, por lo que
+    * alcanza con una pila: reservar y liberar son sumar y restar al tope, sin
+    * pasar por `operator new` salvo al crear el bloque o si éste se agota.
+    */
+    class PilaMarcos {
+        public:
+        static constexpr std::size_t CAPACIDAD = 64 * 1024;
+
+        static PilaMarcos& local() noexcept;
+
+        void* reservar(std::size_t tamano);
+        void liberar(void* marco, std::size_t tamano) noexcept;
+
+        private:
+        std::unique_ptr<std::byte[]> bloque;
+        std::size_t tope = 0;
+
+        static constexpr std::size_t redondear(std::size_t tamano) noexcept;
+    };
+
+    // Base de las promesas: ubica el marco en la `PilaMarcos` del hilo.
+    struct MarcoEnPila {
+        static void* operator new(std::size_t tamano) { return PilaMarcos::local().reservar(tamano); };
+        static void operator delete(void* marco, std::size_t tamano) noexcept { PilaMarcos::local().liberar(marco, tamano); };
+    };
+
+    /**
+    * @brief Objeto devuelto por `get_return_object`.
+    *
+    * Vive en la función que llama a la corrutina, fuera del marco, y recibe el
+    * valor final a través de la promesa. Se convierte en `R` cuando la corrutina
+    * devuelve el control, es decir, ya terminada. Una excepción que escapa del
+    * cuerpo se guarda aquí y se relanza en esa conversión, con el marco ya liberado.
+    *
+    * @note Requiere un compilador que difiera la conversión del objeto de retorno
+    * (GCC, MSVC y Clang 17 o posterior).
+    */
+    template<typename R>
+    class Retorno {
+        public:
+        template<typename P>
+        explicit Retorno(P& promesa) noexcept {
+            promesa.destino = &almacen;
+            promesa.excepcion = &excepcion;
+        };
+        // Sólo se mueve con la corrutina ya terminada: no queda promesa a la que avisar.
+        Retorno(Retorno&& otro) noexcept : almacen(std::move(otro.almacen)), excepcion(std::move(otro.excepcion)) {};
+        Retorno(const Retorno&) = delete;
+
+        operator R();
+
+        private:
+        std::optional<R> almacen;
+        std::exception_ptr excepcion;
+    };
+
+    // Promesa común: la corrutina corre de inmediato y su marco se libera al terminar.
+    template<typename R>
+    struct Promesa : MarcoEnPila {
+        std::optional<R>* destino = nullptr;
+        std::exception_ptr* excepcion = nullptr;
+
+        Retorno<R> get_return_object() noexcept { return Retorno<R>(*this); };
+        std::suspend_never initial_suspend() noexcept { return {}; };
+        std::suspend_never final_suspend() noexcept { return {}; };
+        // No relanza aquí: el marco se libera al salir y la excepción sigue en `Retorno`.
+        void unhandled_exception() noexcept { *excepcion = std::current_exception(); };
+
+        // `co_return x`: construye `R` a partir de `x` (el valor, un error o un `R`).
+        template<typename U>
+        void return_value(U&& valor) { destino->emplace(std::forward<U>(valor)); };
+    };
+
+    /**
+    * @brief Espera sobre un `Resultado` u `Opcion` dentro de una corrutina.
+    *
+    * Si hay valor, `co_await` lo entrega sin suspender (movido si el operando es
+    * un temporal). Si no, completa la corrutina que espera con el error (movido
+    * también si el operando es un temporal) o vacía, y destruye su marco: el
+    * control vuelve directamente a quien la llamó.
+    */
+    template<typename C, bool Mover>
+    struct Espera {
+        C& fuente;
+
+        bool await_ready() noexcept { return static_cast<bool>(fuente); };
+        decltype(auto) await_resume();
+        template<typename P>
+        void await_suspend(std::coroutine_handle<P> corrutina);
+    };
+}
+
+namespace res {
+    template<typename T, typename E>
+    struct PromesaResultado : cor::Promesa<Resultado<T, E>> {
+        // Completa la corrutina con el error `e`.
+        template<typename F>
+        void fallar(F&& e) { this->destino->emplace(en_error, E(std::forward<F>(e))); };
+    };
+
+    // `co_await resultado`: el valor, o propaga el error.
+    template<typename T, typename E>
+    cor::Espera<Resultado<T, E>, true> operator co_await(Resultado<T, E>&& resultado) noexcept { return {resultado}; };
+    template<typename T, typename E>
+    cor::Espera<Resultado<T, E>, false> operator co_await(Resultado<T, E>& resultado) noexcept { return {resultado}; };
+}
+
+namespace opc {
+    template<typename T>
+    struct PromesaOpcion : cor::Promesa<Opcion<T>> {
+        // Completa la corrutina con una opción vacía.
+        void fallar() { this->destino->emplace(); };
+    };
+
+    // `co_await opcion`: el valor, o propaga la ausencia.
+    template<typename T>
+    cor::Espera<Opcion<T>, true> operator co_await(Opcion<T>&& opcion) noexcept { return {opcion}; };
+    template<typename T>
+    cor::Espera<Opcion<T>, false> operator co_await(Opcion<T>& opcion) noexcept { return {opcion}; };
+}
+
+template<typename T, typename E, typename... Args>
+struct std::coroutine_traits<res::Resultado<T, E>, Args...> {
+    using promise_type = res::PromesaResultado<T, E>;
+};
+
+template<typename T, typename... Args>
+struct std::coroutine_traits<opc::Opcion<T>, Args...> {
+    using promise_type = opc::PromesaOpcion<T>;
+};
+
+namespace cor { // Implementación
+    inline PilaMarcos& PilaMarcos::local() noexcept {
+        thread_local PilaMarcos pila;
+        return pila;
+    }
+
+    constexpr std::size_t PilaMarcos::redondear(std::size_t tamano) noexcept {
+        constexpr std::size_t alineacion = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        return (tamano + alineacion - 1) & ~(alineacion - 1);
+    }
+
+    inline void* PilaMarcos::reservar(std::size_t tamano) {
+        tamano = redondear(tamano);
+        if (!bloque) {
+            bloque = std::make_unique_for_overwrite<std::byte[]>(CAPACIDAD);
+        }
+        if (tope + tamano > CAPACIDAD) {
+            return ::operator new(tamano);
+        }
+        void* marco = bloque.get() + tope;
+        tope += tamano;
+        return marco;
+    }
+
+    inline void PilaMarcos::liberar(void* marco, std::size_t tamano) noexcept {
+        auto* byte = static_cast<std::byte*>(marco);
+        if (bloque && byte >= bloque.get() && byte < bloque.get() + CAPACIDAD) {
+            // Orden LIFO: el marco liberado es el último reservado.
+            tope = static_cast<std::size_t>(byte - bloque.get());
+        } else {
+            ::operator delete(marco, redondear(tamano));
+        }
+    }
+
+    template<typename R>
+    Retorno<R>::operator R() {
+        if (excepcion) {
+            std::rethrow_exception(std::exchange(excepcion, nullptr));
+        }
+        return std::move(*almacen);
+    }
+
+    template<typename C, bool Mover>
+    decltype(auto) Espera<C, Mover>::await_resume() {
+        if constexpr (requires { fuente.si(); fuente.Valor(); }) {
+            if constexpr (Mover) {
+                return std::move(fuente).Valor();
+            } else {
+                return fuente.Valor();
+            }
+        } else {
+            // Punteros: se cede la propiedad.
+            auto puntero = std::get<0>(fuente.Consumir());
+            return puntero;
+        }
+    }
+
+    template<typename C, bool Mover>
+    template<typename P>
+    void Espera<C, Mover>::await_suspend(std::coroutine_handle<P> corrutina) {
+        if constexpr (requires { fuente.Error(); }) {
+            if constexpr (Mover) {
+                corrutina.promise().fallar(std::move(fuente).Error());
+            } else {
+                corrutina.promise().fallar(fuente.Error());
+            }
+        } else {
+            corrutina.promise().fallar();
+        }
+        corrutina.destroy();
+    }
+}
+#endif
@@ -2,8 +2,53 @@
 #define ERROR_HPP
 
 
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "Traza.hpp"
+
+// Cada `Error` guarda dónde se creó: un `std::source_location`, que es un puntero
+// a datos estáticos. Definir `ERRORES_SIN_UBICACION` lo elimina por completo.
+#ifndef ERRORES_SIN_UBICACION
+    #include <source_location>
+    #define ERRORES_UBICACION_ACTUAL ::std::source_location::current()
+#else
+    #define ERRORES_UBICACION_ACTUAL ::err::Ubicacion{}
+#endif
+
+// Límites de la imagen del módulo (código, constantes y variables globales), para
+// reconocer los textos de duración estática. Ocultos: cada biblioteca compartida
+// ve los suyos. Débiles: si el enlazador no los define, los textos se copian.
+#if defined(__ELF__)
+    extern "C" {
+        extern const char __ehdr_start[] __attribute__((weak, visibility("hidden")));
+        extern const char _end[] __attribute__((weak, visibility("hidden")));
+    }
+#elif defined(_WIN32)
+    extern "C" const char __ImageBase[];
+#endif
+
+
+// Lo que no conviene expandir en cada destructor: liberar la carga es el camino raro
+// (casi todos los errores no tienen carga o no son su último dueño).
+#if defined(__GNUC__) || defined(__clang__)
+    #define ERRORES_FUERA_DE_LINEA __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+    #define ERRORES_FUERA_DE_LINEA __declspec(noinline)
+#else
+    #define ERRORES_FUERA_DE_LINEA
+#endif
 
 namespace err { // Declaración
     enum CodigoEstado
@@ -13,6 +58,245 @@ namespace err { // Declaración
         EXITO = 0,
     };
 
+    namespace detalle {
+        // La traza de un error nuevo: nunca para un `EXITO`; para el resto, según la política vigente.
+        inline Traza trazar(CodigoEstado codigo) noexcept {
+            return codigo == CodigoEstado::EXITO ? Traza() : Traza::capturar(codigo == CodigoEstado::FATAL);
+        };
+
+        // Reemplaza a `std::source_location` cuando se define `ERRORES_SIN_UBICACION`: vacía y sin costo.
+        struct SinUbicacion {
+            constexpr const char* file_name() const noexcept { return ""; };
+            constexpr const char* function_name() const noexcept { return ""; };
+            constexpr std::uint_least32_t line() const noexcept { return 0; };
+            constexpr std::uint_least32_t column() const noexcept { return 0; };
+        };
+    }
+
+#ifndef ERRORES_SIN_UBICACION
+    using Ubicacion = std::source_location;
+#else
+    using Ubicacion = detalle::SinUbicacion;
+#endif
+
+    /**
+     * @brief Dominio de códigos de error, al estilo de `std::error_category`.
+     *
+     * Un dominio es un objeto único, de duración estática, que da sentido a los
+     * códigos enteros de sus errores: el par (dominio, valor) identifica un fallo
+     * sin comparar mensajes, y se compara por identidad. La severidad sigue
+     * siendo la del `CodigoEstado` del error.
+     *
+     * Para definir un dominio propio se deriva de `Dominio`, se redefine
+     * `Mensaje` y, si sus códigos equivalen a los de otro dominio, `equivalente`:
+     *
+     * ```cpp
+     * struct DominioRed final : err::Dominio {
+     *     constexpr DominioRed() noexcept : err::Dominio("red") {};
+     *     std::string Mensaje(int valor) const override;
+     *     bool equivalente(int propio, const err::Dominio& otro, int valor) const noexcept override {
+     *         return otro == err::dominios::SISTEMA && propio == RECHAZADA && valor == ECONNREFUSED;
+     *     };
+     * };
+     * inline constexpr DominioRed RED;
+     * ```
+     */
+    class Dominio {
+        public:
+        constexpr explicit Dominio(std::string_view nombre) noexcept : nombre(nombre) {};
+        Dominio(const Dominio&) = delete;
+        Dominio& operator=(const Dominio&) = delete;
+
+        constexpr std::string_view Nombre() const noexcept { return nombre; };
+        // Descripción del código `valor` de este dominio.
+        virtual std::string Mensaje(int valor) const;
+        // Si el código `propio` de este dominio equivale al código `valor` de `otro`. Por defecto, ninguno.
+        virtual bool equivalente(int propio, const Dominio& otro, int valor) const noexcept;
+
+        constexpr bool operator==(const Dominio& otro) const noexcept { return this == &otro; };
+
+        protected:
+        ~Dominio() = default;
+
+        private:
+        std::string_view nombre;
+    };
+
+    namespace detalle {
+        // Códigos iguales a los de `CodigoEstado`: el dominio de los errores sin dominio propio.
+        struct DominioGenerico final : Dominio {
+            constexpr DominioGenerico() noexcept : Dominio("generico") {};
+            std::string Mensaje(int valor) const override;
+        };
+
+        // Códigos de `errno`, descritos por `std::generic_category()`.
+        struct DominioSistema final : Dominio {
+            constexpr DominioSistema() noexcept : Dominio("sistema") {};
+            std::string Mensaje(int valor) const override;
+        };
+    }
+
+    namespace dominios {
+        inline constexpr detalle::DominioGenerico GENERICO;
+        inline constexpr detalle::DominioSistema SISTEMA;
+    }
+
+    /**
+     * @brief Descriptor estático de un error: código, categoría y mensaje, y
+     * opcionalmente el dominio y el valor que lo identifican.
+     *
+     * Los descriptores se declaran en tiempo de compilación y viven en memoria
+     * estática, por lo que un error construido a partir de ellos no necesita
+     * copiar ni reservar memoria para su mensaje. Su dirección es su identidad:
+     * dos errores provienen del mismo descriptor si y sólo si apuntan al mismo objeto.
+     *
+     * ```cpp
+     * inline constexpr err::Descriptor DIVISION_POR_CERO{err::ERROR, "aritmetica", "No se puede dividir por cero"};
+     * inline constexpr err::Descriptor CONEXION_RECHAZADA{err::ERROR, RED, RECHAZADA, "Conexión rechazada"};
+     * ```
+     *
+     * Sin dominio, el descriptor pertenece a `dominios::GENERICO` y su valor es su `codigo`.
+     * Con dominio, la categoría es el nombre del dominio.
+     *
+     * @note No es copiable: cada descriptor es único.
+     */
+    struct Descriptor {
+        CodigoEstado codigo;
+        std::string_view categoria;
+        std::string_view mensaje;
+        const Dominio* dominio;
+        int valor;
+
+        constexpr Descriptor(CodigoEstado codigo, std::string_view categoria, std::string_view mensaje) noexcept
+            : codigo(codigo), categoria(categoria), mensaje(mensaje), dominio(&dominios::GENERICO), valor(codigo) {};
+        constexpr Descriptor(CodigoEstado codigo, const Dominio& dominio, int valor, std::string_view mensaje) noexcept
+            : codigo(codigo), categoria(dominio.Nombre()), mensaje(mensaje), dominio(&dominio), valor(valor) {};
+        Descriptor(const Descriptor&) = delete;
+        Descriptor& operator=(const Descriptor&) = delete;
+    };
+
+    namespace catalogo {
+        inline constexpr Descriptor EXITO{CodigoEstado::EXITO, "generico", "Exito"};
+        inline constexpr Descriptor ERROR{CodigoEstado::ERROR, "generico", "Error"};
+        inline constexpr Descriptor FATAL{CodigoEstado::FATAL, "generico", "Error Fatal"};
+        // Estado de un `Resultado` cuyo valor fue movido o consumido.
+        inline constexpr Descriptor MOVIDO{CodigoEstado::ERROR, "generico", "Resultado movido."};
+        // Errores con que se completa un `ResultadoAsync` cancelado o cuya promesa se destruyó.
+        inline constexpr Descriptor CANCELADO{CodigoEstado::ERROR, "asincronia", "Operación cancelada."};
+        inline constexpr Descriptor ABANDONADO{CodigoEstado::ERROR, "asincronia", "Promesa destruida sin completarse."};
+    }
+
+    /**
+     * @brief Manejador de un error del catálogo estático.
+     *
+     * Ocupa lo mismo que un puntero, es trivialmente copiable, no usa memoria
+     * dinámica y se compara por identidad del descriptor al que refiere. Se
+     * convierte implícitamente en `Error` cuando se necesita el tipo general.
+     */
+    class ErrorEstatico {
+        const Descriptor* descriptor;
+        public:
+        constexpr ErrorEstatico(const Descriptor& descriptor) noexcept : descriptor(&descriptor) {};
+        ErrorEstatico(const Descriptor&&) = delete;
+
+        constexpr CodigoEstado Codigo() const noexcept { return descriptor->codigo; };
+        constexpr std::string_view Categoria() const noexcept { return descriptor->categoria; };
+        constexpr const err::Dominio& Dominio() const noexcept { return *descriptor->dominio; };
+        constexpr int Valor() const noexcept { return descriptor->valor; };
+        constexpr const Descriptor& Origen() const noexcept { return *descriptor; };
+        std::string Mensaje() const;
+
+        constexpr operator bool() const noexcept { return descriptor->codigo != CodigoEstado::EXITO; };
+        constexpr bool operator==(const ErrorEstatico& otro) const noexcept = default;
+        constexpr bool operator==(const Descriptor& d) const noexcept { return descriptor == &d; };
+
+        friend std::ostream &operator<<(std::ostream &os, ErrorEstatico const &e){
+            return os << '[' << static_cast<int>(e.descriptor->codigo) << "] " << e.descriptor->mensaje << '\n';
+        }
+    };
+
+    namespace detalle {
+        // Si `p` apunta a la imagen estática del módulo, que vive hasta que el programa
+        // termina. Con `false` el texto se copia: es siempre seguro, sólo más caro.
+        bool enImagen(const void* p) noexcept;
+    }
+
+    /**
+     * @brief Mensaje tomado de un arreglo `const char[N]`: un literal, un arreglo
+     * `static` o uno local.
+     *
+     * Si el arreglo vive en la imagen estática del programa (literales, arreglos
+     * `static` y globales), `Error` guarda una vista al texto sin copiarlo. Si no
+     * (un arreglo local o dentro de un objeto), el texto se copia en la carga. El
+     * texto llega hasta el primer `'\0'`, sin pasar del final del arreglo.
+     */
+    class Literal {
+        std::string_view texto;
+        bool estatico;
+        public:
+        template<std::size_t N>
+        constexpr Literal(const char (&mensaje)[N]) noexcept
+            : texto(hastaNulo({mensaje, N})), estatico(std::is_constant_evaluated() || detalle::enImagen(mensaje)) {};
+        constexpr std::string_view Texto() const noexcept { return texto; };
+        // Si el texto puede guardarse como vista, sin copiarlo.
+        constexpr bool Estatico() const noexcept { return estatico; };
+
+        private:
+        static constexpr std::string_view hastaNulo(std::string_view arreglo) noexcept {
+            return arreglo.substr(0, arreglo.find('\0'));
+        };
+    };
+
+    // Mensaje que se copia en la carga: todo lo convertible a `std::string` salvo
+    // un arreglo `const char[N]`, que va por `Literal`. Un búfer `char[N]` se copia.
+    template<typename S>
+    concept texto_dinamico = std::convertible_to<S, std::string>
+        && !(std::is_array_v<std::remove_reference_t<S>>
+             && std::is_const_v<std::remove_extent_t<std::remove_reference_t<S>>>);
+
+    namespace detalle {
+        /**
+         * @brief Carga inmutable y compartida de un `Error`: su mensaje dinámico y
+         * su cadena de contexto.
+         *
+         * Cada bloque lleva su propio contador de referencias atómico (conteo
+         * intrusivo), de modo que copiar un `Error` cuesta copiar un puntero e
+         * incrementar un contador, sin duplicar cadenas. Los bloques forman una
+         * cadena: cada `agregarMensaje` crea uno nuevo que retiene al anterior, y
+         * `longitud` es el largo total de los marcos hasta ese bloque. El primer
+         * bloque puede guardar el mensaje dinámico en lugar de un marco.
+         *
+         * Una vez publicado, un bloque no cambia, salvo el texto decorado, que se
+         * arma a lo sumo una vez y se publica con una operación atómica.
+         */
+        struct Carga {
+            mutable std::atomic<std::size_t> referencias{1};
+            const Carga* anterior;
+            std::string texto;
+            // El mensaje crudo del error: un literal o el `texto` del primer bloque.
+            std::string_view mensaje;
+            std::size_t longitud;
+            // Si `texto` es un marco de contexto (y no el mensaje).
+            bool marco;
+            mutable std::atomic<const std::string*> decorado{nullptr};
+            // La pila al crear el error; sólo el primer bloque de la cadena la lleva.
+            [[no_unique_address]] Traza traza;
+
+            Carga(const Carga* anterior, std::string texto, std::string_view mensaje, bool marco);
+            ~Carga() { delete decorado.load(std::memory_order_acquire); };
+            Carga(const Carga&) = delete;
+            Carga& operator=(const Carga&) = delete;
+        };
+
+        // Suma una referencia a `carga`, si no es nula.
+        const Carga* retener(const Carga* carga) noexcept;
+        // Resta una referencia a `carga` y libera los bloques que queden sin referencias.
+        void liberar(const Carga* carga) noexcept;
+
+        // La traza de los errores que no capturaron ningún marco.
+        inline const Traza SIN_MARCOS{};
+    }
+
     /**
      * @brief Tipo que representa un error con un código y un mensaje descriptivo.
      *
@@ -26,74 +310,530 @@ namespace err { // Declaración
      * Además, sobrecarga varios operadores para permitir el uso conveniente del tipo en
      * expresiones booleanas y de conversión a tipos como `std::string` o `const char*`.
      *
+     * **Construcción perezosa del mensaje**: el `Error` sólo guarda el código y el
+     * mensaje "crudo". El texto decorado (`"[codigo] mensaje\n"`) se arma recién cuando
+     * se lo solicita mediante `Mensaje()`, las conversiones a cadena o `operator<<`.
+     * Los literales de cadena no se copian: se guarda una vista a ellos, por lo que
+     * construir, verificar y descartar un `Error` a partir de un literal no reserva memoria.
+     *
+     * **Contexto**: `agregarMensaje` agrega un eslabón a una cadena de marcos
+     * inmutables y compartidos, en O(1) sin importar cuánto contexto haya. El
+     * texto de los marcos, en el orden en que se agregaron, se une al mensaje
+     * recién al armar el texto decorado. `Error(Error*)` envuelve otro error:
+     * comparte su cadena, y lo que se agregue después no afecta al original.
+     *
+     * **Copias**: el mensaje dinámico y el contexto viven en una carga inmutable
+     * con conteo de referencias atómico (`detalle::Carga`). Copiar un `Error` es
+     * copiar un puntero e incrementar un contador, y las copias pueden pasar
+     * libremente entre hilos. Los errores con mensaje literal o de catálogo no
+     * tienen carga. Un `EXITO` nunca la tiene: conserva un mensaje literal, pero
+     * un mensaje dinámico se reemplaza por el del catálogo y el contexto que se
+     * le agregue se descarta.
+     *
+     * **Dominio**: cada error lleva un `Dominio` y un código entero (`Valor()`),
+     * para decidir qué hacer con él en O(1) sin comparar mensajes. `equivale`
+     * consulta además las equivalencias que declaran los dominios (por ejemplo,
+     * entre un código propio y un `errno`). Los errores sin dominio pertenecen a
+     * `dominios::GENERICO`, con su `CodigoEstado` como valor. `operator bool`
+     * sigue dependiendo sólo del `CodigoEstado`.
+     *
+     * **Ubicación**: los constructores y `Generico`, `Fatal` y `Exito` registran
+     * dónde se creó el error (`Donde()`), sin reservar memoria: sólo guardan un
+     * `std::source_location`. Con `ERRORES_SIN_UBICACION` el registro desaparece
+     * y `Donde()` devuelve una ubicación vacía.
+     *
+     * **Traza**: si se compila con `ERRORES_TRAZA` (ver `Traza.hpp`), un error
+     * guarda las direcciones de retorno de la pila al construirse, según la
+     * política vigente (nunca, sólo fatales o todos). Los símbolos se resuelven
+     * recién al imprimirlo con `Mensaje()` u `operator<<`, que agregan la traza
+     * al final. Sin `ERRORES_TRAZA`, no ocupa lugar.
+     *
+     * Un `Error` construido a partir de un `Descriptor` (o de un `ErrorEstatico`)
+     * sólo guarda la dirección del descriptor; su identidad puede consultarse con
+     * `Origen()` o comparando contra el descriptor (`e == MI_DESCRIPTOR`).
+     *
+     * @note Sólo los literales y los arreglos `static` (ver `Literal`) se guardan
+     * como vista; cualquier otro texto, incluidos un búfer `char[N]` y un arreglo
+     * `const char[N]` local, se copia.
+     *
      * @note El operador `<<` permite imprimir un objeto del tipo `Error` utilizando
      * flujos de salida estándar como `std::cout`.
      */
     struct Error{
         protected:
-        CodigoEstado codigo;
-        std::string mensaje;
+        // Largo máximo de un mensaje literal guardado como vista; uno más largo se copia.
+        static constexpr std::size_t LARGO_LITERAL = (std::size_t{1} << 24) - 1;
+
+        CodigoEstado codigo : 8;
+        std::uint32_t largo : 24 = 0;
+        int valor = static_cast<int>(codigo);
+        // Un `Descriptor`, marcado con el bit bajo, del que salen el mensaje y el
+        // dominio; o, sin descriptor, el `Dominio` del error.
+        std::uintptr_t origen = reinterpret_cast<std::uintptr_t>(&dominios::GENERICO);
+        // El mensaje literal (`largo` bytes), si no hay descriptor ni carga.
+        const char* literal = nullptr;
+        [[no_unique_address]] Ubicacion donde;
+        // Atómica porque las conversiones a `const char*` la crean al vuelo en errores sin carga.
+        mutable std::atomic<const detalle::Carga*> carga{nullptr};
+
+        const Descriptor* descriptor() const noexcept {
+            return (origen & 1) != 0 ? reinterpret_cast<const Descriptor*>(origen & ~std::uintptr_t{1}) : nullptr;
+        };
+        void ponerLiteral(std::string_view texto) noexcept {
+            literal = texto.data();
+            largo = static_cast<std::uint32_t>(texto.size());
+        };
+        void ponerDominio(const err::Dominio& dominio) noexcept { origen = reinterpret_cast<std::uintptr_t>(&dominio); };
+        // Captura la pila del error recién construido y, si hay marcos, la guarda en
+        // `propia` (la carga que el constructor acaba de crear) o en una nueva.
+        void trazar(detalle::Carga* propia = nullptr) noexcept;
+        std::string_view crudo() const noexcept;
+        std::string armar() const;
+        // El texto decorado guardado en la carga, para las conversiones a cadena estilo C.
+        const std::string& decorado() const;
+        // Los marcos de contexto, del más antiguo al más reciente.
+        std::vector<const detalle::Carga*> marcos() const;
         public:
-        Error() noexcept : Error{CodigoEstado::ERROR, "ERROR"} {};
-        explicit Error(CodigoEstado codigo, std::string mensaje = "ERROR");
-        explicit Error(Error *e); // <HACER/>
-        CodigoEstado Codigo();
-        std::string Mensaje();
+        Error(Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept : Error{CodigoEstado::ERROR, donde} {};
+        explicit Error(CodigoEstado codigo, Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept
+            : codigo(codigo), largo(5), literal("ERROR"), donde(donde) { trazar(); };
+        explicit Error(CodigoEstado codigo, Literal mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL);
+        template<typename S> requires texto_dinamico<S>
+        explicit Error(CodigoEstado codigo, S&& mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL);
+        explicit Error(CodigoEstado codigo, const err::Dominio& dominio, int valor, Literal mensaje,
+                       Ubicacion donde = ERRORES_UBICACION_ACTUAL);
+        template<typename S> requires texto_dinamico<S>
+        explicit Error(CodigoEstado codigo, const err::Dominio& dominio, int valor, S&& mensaje,
+                       Ubicacion donde = ERRORES_UBICACION_ACTUAL);
+        // Con el mensaje que el dominio da para `valor`.
+        explicit Error(CodigoEstado codigo, const err::Dominio& dominio, int valor, Ubicacion donde = ERRORES_UBICACION_ACTUAL);
+        Error(const Descriptor& d, Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept
+            : codigo(d.codigo), valor(d.valor), origen(reinterpret_cast<std::uintptr_t>(&d) | 1), donde(donde) { trazar(); };
+        Error(const Descriptor&&) = delete;
+        Error(ErrorEstatico e, Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept : Error{e.Origen(), donde} {};
+        // Envuelve `e`: mismo código, mensaje y contexto, sin copiar el contexto. Con `nullptr`, un `ERROR` genérico.
+        explicit Error(Error *e);
+        Error(const Error& otro) noexcept;
+        Error(Error&& otro) noexcept;
+        Error& operator=(const Error& otro) noexcept;
+        Error& operator=(Error&& otro) noexcept;
+        ~Error() {
+            // Un error movido o sin carga no llama a nada.
+            if (const detalle::Carga* c = carga.load(std::memory_order_relaxed); c != nullptr) {
+                detalle::liberar(c);
+            }
+        };
+        CodigoEstado Codigo() const;
+        std::string Mensaje() const;
+        const Descriptor* Origen() const noexcept;
+        const err::Dominio& Dominio() const noexcept {
+            const Descriptor* d = descriptor();
+            return d != nullptr ? *d->dominio : *reinterpret_cast<const err::Dominio*>(origen);
+        };
+        int Valor() const noexcept { return valor; };
+        // Dónde se creó el error. Vacía con `ERRORES_SIN_UBICACION`.
+        const Ubicacion& Donde() const noexcept { return donde; };
+        // La pila al crear el error, sin resolver. Vacía sin `ERRORES_TRAZA` o si la política no la pidió.
+        const Traza& Pila() const noexcept;
+        // Si el error es el código `valor` de `dominio`, o alguno de los dos dominios los declara equivalentes.
+        bool equivale(const err::Dominio& dominio, int valor) const noexcept;
 
         void agregarMensaje(std::string mensaje);
+        // El texto de cada marco de contexto, en el orden en que se agregaron.
+        std::vector<std::string_view> Contexto() const;
 
         operator bool();
+        // Necesario para que `if (r.Error())` sobre un `const Error&` no elija `operator const char*`.
+        operator bool() const;
         operator std::string() const;
         operator const char*() const;
         operator char*();
 
+        bool operator==(const Descriptor& d) const noexcept { return descriptor() == &d; };
     
         // Sobrecarga del operador << para hacer que Error sea "imprimible" con cualquier "output stream", e.g., std::cout.
+        // Escribe las partes directamente en el flujo, sin construir el texto decorado.
         friend std::ostream &operator<<(std::ostream &os, Error const &e){
-            return os << e.mensaje;
+            os << '[' << static_cast<int>(e.codigo) << "] " << e.crudo() << '\n';
+            for (const detalle::Carga* marco : e.marcos()) {
+                os << marco->texto;
+            }
+            if (const Traza& traza = e.Pila(); !traza.vacia()) {
+                std::string pila;
+                traza.escribir(pila);
+                os << "Traza:\n" << pila;
+            }
+            return os;
         }
     };
 }
 
 namespace err { //Implementación
-    inline Error::Error(CodigoEstado codigo, std::string mensaje){
-        this->codigo = codigo;
-        this->mensaje = "[" + std::to_string(codigo) + "] " + mensaje + "\n";
+    inline std::string Dominio::Mensaje(int valor) const {
+        return std::string(nombre).append(":").append(std::to_string(valor));
+    };
+
+    inline bool Dominio::equivalente(int, const Dominio&, int) const noexcept {
+        return false;
     };
+
+    namespace detalle {
+        inline std::string DominioGenerico::Mensaje(int valor) const {
+            switch (valor) {
+                case CodigoEstado::EXITO: return std::string(catalogo::EXITO.mensaje);
+                case CodigoEstado::FATAL: return std::string(catalogo::FATAL.mensaje);
+                default: return std::string(catalogo::ERROR.mensaje);
+            }
+        };
+
+        inline std::string DominioSistema::Mensaje(int valor) const {
+            return std::generic_category().message(valor);
+        };
+    }
+
+    inline std::string ErrorEstatico::Mensaje() const {
+        std::string texto;
+        texto.reserve(descriptor->mensaje.size() + 8);
+        texto.append("[").append(std::to_string(descriptor->codigo)).append("] ").append(descriptor->mensaje).append("\n");
+        return texto;
+    };
+
+    namespace detalle {
+        inline bool enImagen(const void* p) noexcept {
+            std::uintptr_t direccion = reinterpret_cast<std::uintptr_t>(p);
+            #if defined(__ELF__)
+                if (__ehdr_start == nullptr || _end == nullptr) {
+                    return false;
+                }
+                return direccion >= reinterpret_cast<std::uintptr_t>(__ehdr_start)
+                    && direccion < reinterpret_cast<std::uintptr_t>(_end);
+            #elif defined(_WIN32)
+                // `__ImageBase` es la cabecera DOS; `SizeOfImage` está en la cabecera PE
+                // (desplazamiento 0x3C), 0x50 bytes después de su comienzo.
+                const char* base = __ImageBase;
+                std::int32_t cabecera;
+                std::uint32_t tamano;
+                std::memcpy(&cabecera, base + 0x3C, sizeof(cabecera));
+                std::memcpy(&tamano, base + cabecera + 0x50, sizeof(tamano));
+                return direccion >= reinterpret_cast<std::uintptr_t>(base)
+                    && direccion < reinterpret_cast<std::uintptr_t>(base) + tamano;
+            #else
+                (void)direccion;
+                return false;
+            #endif
+        };
+
+        inline Carga::Carga(const Carga* anterior, std::string texto, std::string_view mensaje, bool marco)
+            : anterior(anterior), texto(std::move(texto)), mensaje(mensaje),
+              longitud((anterior != nullptr ? anterior->longitud : 0) + (marco ? this->texto.size() : 0)), marco(marco) {
+            if (!marco && mensaje.data() == nullptr) {
+                this->mensaje = this->texto;
+            }
+        };
+
+        inline const Carga* retener(const Carga* carga) noexcept {
+            if (carga != nullptr) {
+                // Quien copia ya tiene una referencia: basta con `relaxed`.
+                carga->referencias.fetch_add(1, std::memory_order_relaxed);
+            }
+            return carga;
+        };
+
+        ERRORES_FUERA_DE_LINEA inline void liberar(const Carga* carga) noexcept {
+            // Iterativo: una cadena de contexto larga no debe agotar la pila.
+            while (carga != nullptr && carga->referencias.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                const Carga* anterior = carga->anterior;
+                delete carga;
+                carga = anterior;
+            }
+        };
+    }
+
+    inline Error::Error(CodigoEstado codigo, Literal mensaje, Ubicacion donde) : codigo(codigo), donde(donde) {
+        detalle::Carga* nueva = nullptr;
+        if (mensaje.Estatico() && mensaje.Texto().size() <= LARGO_LITERAL) {
+            ponerLiteral(mensaje.Texto());
+        } else if (codigo == CodigoEstado::EXITO) {
+            // Un `EXITO` no lleva carga: el texto que habría que copiar se descarta.
+            ponerLiteral(catalogo::EXITO.mensaje);
+        } else {
+            nueva = new detalle::Carga(nullptr, std::string(mensaje.Texto()), {}, false);
+            carga.store(nueva, std::memory_order_relaxed);
+        }
+        trazar(nueva);
+    };
+
+    inline Error::Error(CodigoEstado codigo, const err::Dominio& dominio, int valor, Literal mensaje, Ubicacion donde)
+        : Error(codigo, mensaje, donde) {
+        this->valor = valor;
+        ponerDominio(dominio);
+    };
+
+    template<typename S> requires texto_dinamico<S>
+    inline Error::Error(CodigoEstado codigo, S&& mensaje, Ubicacion donde) : codigo(codigo), donde(donde) {
+        detalle::Carga* nueva = nullptr;
+        if (codigo == CodigoEstado::EXITO) {
+            ponerLiteral(catalogo::EXITO.mensaje);
+        } else {
+            nueva = new detalle::Carga(nullptr, std::string(std::forward<S>(mensaje)), {}, false);
+            carga.store(nueva, std::memory_order_relaxed);
+        }
+        trazar(nueva);
+    };
+
+    template<typename S> requires texto_dinamico<S>
+    inline Error::Error(CodigoEstado codigo, const err::Dominio& dominio, int valor, S&& mensaje, Ubicacion donde)
+        : Error(codigo, std::forward<S>(mensaje), donde) {
+        this->valor = valor;
+        ponerDominio(dominio);
+    };
+
+    inline Error::Error(CodigoEstado codigo, const err::Dominio& dominio, int valor, Ubicacion donde)
+        : Error(codigo, dominio, valor, dominio.Mensaje(valor), donde) {};
+
+    inline Error::Error(Error *e) : Error(e != nullptr ? Error(*e) : Error()) {};
+
+    inline Error::Error(const Error& otro) noexcept
+        : codigo(otro.codigo), largo(otro.largo), valor(otro.valor), origen(otro.origen), literal(otro.literal), donde(otro.donde),
+          carga(detalle::retener(otro.carga.load(std::memory_order_acquire))) {};
+
+    inline Error::Error(Error&& otro) noexcept
+        : codigo(otro.codigo), largo(otro.largo), valor(otro.valor), origen(otro.origen), literal(otro.literal), donde(otro.donde),
+          carga(otro.carga.load(std::memory_order_relaxed)) {
+        // Quien mueve tiene acceso exclusivo a `otro`: basta con leer y vaciar, sin un intercambio atómico.
+        otro.carga.store(nullptr, std::memory_order_relaxed);
+    };
+
+    inline Error& Error::operator=(const Error& otro) noexcept {
+        const detalle::Carga* nueva = detalle::retener(otro.carga.load(std::memory_order_acquire));
+        detalle::liberar(carga.exchange(nueva, std::memory_order_acq_rel));
+        codigo = otro.codigo;
+        largo = otro.largo;
+        valor = otro.valor;
+        origen = otro.origen;
+        literal = otro.literal;
+        donde = otro.donde;
+        return *this;
+    };
+
+    inline Error& Error::operator=(Error&& otro) noexcept {
+        if (this != &otro) {
+            // Como al construir por movimiento: ambos lados son exclusivos de quien asigna.
+            const detalle::Carga* anterior = carga.load(std::memory_order_relaxed);
+            carga.store(otro.carga.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            otro.carga.store(nullptr, std::memory_order_relaxed);
+            if (anterior != nullptr) {
+                detalle::liberar(anterior);
+            }
+            codigo = otro.codigo;
+            largo = otro.largo;
+            valor = otro.valor;
+            origen = otro.origen;
+            literal = otro.literal;
+            donde = otro.donde;
+        }
+        return *this;
+    };
+
+    inline void Error::trazar(detalle::Carga* propia) noexcept {
+        if constexpr (ERRORES_TRAZA > 0) {
+            Traza pila = detalle::trazar(codigo);
+            if (pila.vacia()) {
+                return;
+            }
+            if (propia == nullptr) {
+                // Un bloque sólo para los marcos; sin memoria, el error queda sin traza.
+                propia = new (std::nothrow) detalle::Carga(nullptr, {}, crudo(), false);
+                if (propia == nullptr) {
+                    return;
+                }
+                carga.store(propia, std::memory_order_relaxed);
+            }
+            propia->traza = pila;
+        }
+    };
+
+    inline const Traza& Error::Pila() const noexcept {
+        if constexpr (ERRORES_TRAZA > 0) {
+            const detalle::Carga* c = carga.load(std::memory_order_acquire);
+            if (c != nullptr) {
+                while (c->anterior != nullptr) {
+                    c = c->anterior;
+                }
+                return c->traza;
+            }
+        }
+        return detalle::SIN_MARCOS;
+    };
+
+    inline std::string_view Error::crudo() const noexcept {
+        const detalle::Carga* c = carga.load(std::memory_order_acquire);
+        if (c != nullptr) {
+            return c->mensaje;
+        }
+        const Descriptor* d = descriptor();
+        return d != nullptr ? d->mensaje : std::string_view(literal, largo);
+    };
+
+    inline std::vector<const detalle::Carga*> Error::marcos() const {
+        std::vector<const detalle::Carga*> lista;
+        for (const detalle::Carga* c = carga.load(std::memory_order_acquire); c != nullptr; c = c->anterior) {
+            if (c->marco) {
+                lista.push_back(c);
+            }
+        }
+        return {lista.rbegin(), lista.rend()};
+    };
+
+    inline std::string Error::armar() const {
+        const detalle::Carga* c = carga.load(std::memory_order_acquire);
+        std::string_view m = crudo();
+        std::string texto;
+        texto.reserve(m.size() + (c != nullptr ? c->longitud : 0) + 8);
+        texto.append("[").append(std::to_string(codigo)).append("] ").append(m).append("\n");
+        if (c != nullptr && c->longitud != 0) {
+            // Los marcos se recorren del más reciente al más antiguo: cada uno se copia
+            // directamente en su lugar, que `longitud` indica, sin listarlos antes.
+            std::size_t base = texto.size();
+            texto.resize(base + c->longitud);
+            for (; c != nullptr; c = c->anterior) {
+                if (c->marco) {
+                    std::memcpy(texto.data() + base + c->longitud - c->texto.size(), c->texto.data(), c->texto.size());
+                }
+            }
+        }
+        const Traza& pila = Pila();
+        if (!pila.vacia()) {
+            texto.append("Traza:\n");
+            pila.escribir(texto);
+        }
+        return texto;
+    };
+
+    inline const std::string& Error::decorado() const {
+        const detalle::Carga* c = carga.load(std::memory_order_acquire);
+        if (c == nullptr) {
+            // Un error sin carga recibe una vacía sólo para guardar su texto decorado.
+            const detalle::Carga* nueva = new detalle::Carga(nullptr, {}, crudo(), false);
+            if (carga.compare_exchange_strong(c, nueva, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                c = nueva;
+            } else {
+                delete nueva;
+            }
+        }
+        const std::string* texto = c->decorado.load(std::memory_order_acquire);
+        if (texto == nullptr) {
+            const std::string* armado = new std::string(armar());
+            if (c->decorado.compare_exchange_strong(texto, armado, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                texto = armado;
+            } else {
+                delete armado;
+            }
+        }
+        return *texto;
+    };
+
     inline void Error::agregarMensaje(std::string mensaje){
-        this->mensaje = this->mensaje.append(mensaje);
+        if (codigo == CodigoEstado::EXITO) {
+            return;
+        }
+        // El bloque nuevo hereda la referencia que este error tenía sobre el actual.
+        const detalle::Carga* actual = carga.load(std::memory_order_relaxed);
+        carga.store(new detalle::Carga(actual, std::move(mensaje), crudo(), true), std::memory_order_release);
     };
 
-    inline std::string Error::Mensaje(){
-        return mensaje;
+    inline std::vector<std::string_view> Error::Contexto() const {
+        std::vector<std::string_view> textos;
+        for (const detalle::Carga* marco : marcos()) {
+            textos.emplace_back(marco->texto);
+        }
+        return textos;
     };
-    inline CodigoEstado Error::Codigo(){
+
+    inline std::string Error::Mensaje() const {
+        return armar();
+    };
+    inline const Descriptor* Error::Origen() const noexcept {
+        return descriptor();
+    };
+    inline bool Error::equivale(const err::Dominio& dominio, int valor) const noexcept {
+        const err::Dominio& propio = Dominio();
+        return (&propio == &dominio && this->valor == valor)
+            || propio.equivalente(this->valor, dominio, valor)
+            || dominio.equivalente(valor, propio, this->valor);
+    };
+
+    inline CodigoEstado Error::Codigo() const {
         return codigo;
     };
 
     inline Error::operator bool(){ return (this->codigo != CodigoEstado::EXITO); };
+    inline Error::operator bool() const { return (this->codigo != CodigoEstado::EXITO); };
 
-    inline Error::operator std::string() const  { return mensaje ;}
-    inline Error::operator const char*() const  { return mensaje.c_str() ;}
-    inline Error::operator char*() { return const_cast<char*>(mensaje.c_str()) ;}
+    inline Error::operator std::string() const  { return armar() ;}
+    inline Error::operator const char*() const  { return decorado().c_str() ;}
+    inline Error::operator char*() { return const_cast<char*>(decorado().c_str()) ;}
 
-    inline Error Exito(std::string mensaje ="Exito"){
+    inline Error Exito(Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept {
+        return Error(catalogo::EXITO, donde);
+    }
+    inline Error Exito(Literal mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL) {
+        return Error(
+            CodigoEstado::EXITO,
+            mensaje,
+            donde
+        );
+    }
+    template<typename S> requires texto_dinamico<S>
+    inline Error Exito(S&& mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL){
         return Error(
             CodigoEstado::EXITO,
-            mensaje
+            std::forward<S>(mensaje),
+            donde
         );
     }
-    inline Error Fatal(std::string mensaje ="Error Fatal"){
+
+    inline Error Fatal(Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept {
+        return Error(catalogo::FATAL, donde);
+    }
+    inline Error Fatal(Literal mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL) {
         return Error(
             CodigoEstado::FATAL,
-            mensaje
+            mensaje,
+            donde
+        );
+    }
+    template<typename S> requires texto_dinamico<S>
+    inline Error Fatal(S&& mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL){
+        return Error(
+            CodigoEstado::FATAL,
+            std::forward<S>(mensaje),
+            donde
+        );
+    }
+
+    // Un error del dominio `dominios::SISTEMA` a partir de un `errno`.
+    inline Error Sistema(int valor, CodigoEstado codigo = CodigoEstado::ERROR, Ubicacion donde = ERRORES_UBICACION_ACTUAL) {
+        return Error(codigo, dominios::SISTEMA, valor, donde);
+    }
+
+    inline Error Generico(Ubicacion donde = ERRORES_UBICACION_ACTUAL) noexcept {
+        return Error(catalogo::ERROR, donde);
+    }
+    inline Error Generico(Literal mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL) {
+        return Error(
+            CodigoEstado::ERROR,
+            mensaje,
+            donde
         );
     }
-    inline Error Generico(std::string mensaje ="Error"){
+    template<typename S> requires texto_dinamico<S>
+    inline Error Generico(S&& mensaje, Ubicacion donde = ERRORES_UBICACION_ACTUAL){
         return Error(
             CodigoEstado::ERROR,
-            mensaje
+            std::forward<S>(mensaje),
+            donde
         );
     }
 }
-#endif
\ No newline at end of file
+#endif
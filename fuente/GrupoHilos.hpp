@@ -0,0 +1,351 @@
+#ifndef GRUPO_HILOS_HPP
+#define GRUPO_HILOS_HPP
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptos.hpp>
+#include "Error.hpp"
+#include "Resultado.hpp"
+#include "ResultadoAsync.hpp"
+
+namespace res { // Declaración
+    /**
+    * @brief Grupo de hilos con robo de trabajo.
+    *
+    * Cada hilo tiene su propia cola: toma sus tareas desde el final y, cuando se
+    * queda sin trabajo, roba desde el principio de las colas ajenas. Las tareas
+    * enviadas desde un hilo del grupo van al final de su propia cola (la más
+    * reciente se ejecuta primero, con sus datos aún en caché); las enviadas desde
+    * fuera se reparten en ronda al principio de las colas y se ejecutan en orden
+    * de llegada.
+    * Los hilos ociosos esperan con `std::atomic::wait`.
+    *
+    * Cumple el concepto `ejecutor`, por lo que sirve para `ResultadoAsync::luego`.
+    * Una excepción que escapa de una tarea no detiene al hilo: se descarta.
+    * Al destruirse, termina las tareas pendientes y espera a sus hilos.
+    */
+    class GrupoHilos {
+        public:
+        explicit GrupoHilos(std::size_t hilos = std::thread::hardware_concurrency());
+        ~GrupoHilos();
+        GrupoHilos(const GrupoHilos&) = delete;
+        GrupoHilos& operator=(const GrupoHilos&) = delete;
+
+        void ejecutar(Tarea tarea);
+        std::size_t tamano() const noexcept { return colas.size(); };
+
+        // Ejecuta una tarea pendiente, si la hay, en el hilo que llama. Devuelve `false` si no había.
+        bool ayudar();
+        // Indica si el hilo que llama pertenece a este grupo.
+        bool esPropio() const noexcept { return grupoActual == this; };
+
+        private:
+        struct alignas(64) Cola {
+            std::mutex cerrojo;
+            std::deque<Tarea> tareas;
+        };
+
+        std::vector<std::unique_ptr<Cola>> colas;
+        std::vector<std::thread> hilos;
+        std::atomic<std::size_t> siguiente{0};
+        std::atomic<std::size_t> pendientes{0};
+        std::atomic<std::uint32_t> senal{0};
+        std::atomic<bool> detener{false};
+
+        inline static thread_local GrupoHilos* grupoActual = nullptr;
+        inline static thread_local std::size_t indiceActual = 0;
+
+        void trabajar(std::size_t indice);
+        std::optional<Tarea> tomar(std::size_t indice);
+        static void correr(Tarea& tarea) noexcept;
+    };
+
+    // Permite a una tarea en curso consultar si su lote fue cancelado.
+    class TokenCancelacion {
+        public:
+        explicit TokenCancelacion(const std::atomic<bool>& bandera) noexcept : bandera(&bandera) {};
+        bool cancelado() const noexcept { return bandera->load(std::memory_order_relaxed); };
+
+        private:
+        const std::atomic<bool>* bandera;
+    };
+
+    // Tipos de error que admite un `LoteTareas`: además de los de `ResultadoAsync`,
+    // `RasgosError<E>` indica qué error cancela el lote y cuál representa una excepción.
+    template<typename E>
+    concept error_de_lote = error_asincrono<E> && requires(const E& e, std::string_view mensaje) {
+        { RasgosError<E>::esFatal(e) } -> std::convertible_to<bool>;
+        { RasgosError<E>::fatal(mensaje) } -> std::convertible_to<E>;
+    };
+
+    // Resultado de un `LoteTareas`: uno por tarea, en el orden de lanzamiento.
+    template<typename T, typename E = err::Error>
+    struct ResumenLote {
+        std::vector<Resultado<T, E>> resultados;
+        // Índices de las tareas que fallaron sin ser fatales ni canceladas antes de correr.
+        std::vector<std::size_t> errores;
+        // Índice de la primera tarea que falló con un error fatal, si hubo alguna.
+        std::optional<std::size_t> fatal;
+        // Tareas que no llegaron a ejecutarse por la cancelación (completadas con `cancelado()`).
+        std::size_t canceladas = 0;
+    };
+
+    /**
+    * @brief Conjunto de tareas que devuelven `Resultado<T, E>` y se ejecutan en un `GrupoHilos`.
+    *
+    * Los errores de cada tarea se recolectan en el `ResumenLote`. El primer error
+    * fatal (`RasgosError<E>::esFatal`, el `FATAL` de `err::Error`) cancela el
+    * lote: las tareas aún en cola no se ejecutan (su resultado es
+    * `RasgosError<E>::cancelado()`) y las que están corriendo pueden advertirlo
+    * con el `TokenCancelacion` que reciben. Una excepción que escapa de una tarea
+    * se trata como fatal.
+    *
+    * Las tareas se lanzan desde un único hilo. `esperar()` se llama una vez; si se
+    * llama desde un hilo del grupo, ejecuta tareas pendientes mientras espera.
+    */
+    template<typename T, typename E = err::Error>
+        requires error_de_lote<E>
+    class LoteTareas {
+        public:
+        explicit LoteTareas(GrupoHilos& grupo) : grupo(grupo), estado(std::make_shared<Estado>()) {};
+        ~LoteTareas();
+        LoteTareas(const LoteTareas&) = delete;
+        LoteTareas& operator=(const LoteTareas&) = delete;
+
+        // `f()` o `f(const TokenCancelacion&)`, que devuelve `Resultado<T, E>`.
+        template<typename F>
+        void lanzar(F&& f);
+        ResumenLote<T, E> esperar();
+        void cancelar() noexcept { estado->cancelado.store(true, std::memory_order_relaxed); };
+
+        private:
+        static constexpr std::size_t SIN_FATAL = std::numeric_limits<std::size_t>::max();
+
+        struct Estado {
+            std::atomic<bool> cancelado{false};
+            std::atomic<std::size_t> pendientes{0};
+            std::atomic<std::size_t> fatal{SIN_FATAL};
+        };
+
+        struct Ranura {
+            std::optional<Resultado<T, E>> resultado;
+            // La tarea no llegó a correr: su error lo puso la cancelación, no `f`.
+            bool cancelada = false;
+        };
+
+        GrupoHilos& grupo;
+        std::shared_ptr<Estado> estado;
+        // `std::deque` no mueve los elementos al crecer: cada tarea escribe en su ranura.
+        std::deque<Ranura> ranuras;
+
+        void aguardar();
+    };
+}
+
+namespace res { // Implementación
+    /*
+     *  GrupoHilos
+     */
+
+    inline GrupoHilos::GrupoHilos(std::size_t cantidad) {
+        cantidad = cantidad == 0 ? 1 : cantidad;
+        colas.reserve(cantidad);
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            colas.push_back(std::make_unique<Cola>());
+        }
+        hilos.reserve(cantidad);
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            hilos.emplace_back([this, i] { trabajar(i); });
+        }
+    }
+
+    inline GrupoHilos::~GrupoHilos() {
+        detener.store(true, std::memory_order_release);
+        senal.fetch_add(1, std::memory_order_release);
+        senal.notify_all();
+        for (auto& hilo : hilos) {
+            hilo.join();
+        }
+    }
+
+    inline void GrupoHilos::ejecutar(Tarea tarea) {
+        if (esPropio()) {
+            std::lock_guard bloqueo(colas[indiceActual]->cerrojo);
+            colas[indiceActual]->tareas.push_back(std::move(tarea));
+        } else {
+            // Desde fuera, al principio: el dueño las toma en orden de llegada.
+            std::size_t indice = siguiente.fetch_add(1, std::memory_order_relaxed) % colas.size();
+            std::lock_guard bloqueo(colas[indice]->cerrojo);
+            colas[indice]->tareas.push_front(std::move(tarea));
+        }
+        pendientes.fetch_add(1, std::memory_order_release);
+        senal.fetch_add(1, std::memory_order_release);
+        senal.notify_one();
+    }
+
+    inline std::optional<Tarea> GrupoHilos::tomar(std::size_t indice) {
+        {
+            Cola& propia = *colas[indice];
+            std::lock_guard bloqueo(propia.cerrojo);
+            if (!propia.tareas.empty()) {
+                Tarea tarea = std::move(propia.tareas.back());
+                propia.tareas.pop_back();
+                pendientes.fetch_sub(1, std::memory_order_relaxed);
+                return tarea;
+            }
+        }
+        for (std::size_t salto = 1; salto < colas.size(); ++salto) {
+            Cola& ajena = *colas[(indice + salto) % colas.size()];
+            std::lock_guard bloqueo(ajena.cerrojo);
+            if (!ajena.tareas.empty()) {
+                Tarea tarea = std::move(ajena.tareas.front());
+                ajena.tareas.pop_front();
+                pendientes.fetch_sub(1, std::memory_order_relaxed);
+                return tarea;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Las tareas de `LoteTareas` y de `luego` ya convierten sus excepciones en el error
+    // fatal de su resultado; una tarea suelta no tiene resultado al que llevarla.
+    inline void GrupoHilos::correr(Tarea& tarea) noexcept {
+        try {
+            tarea();
+        } catch (...) {
+        }
+    }
+
+    inline bool GrupoHilos::ayudar() {
+        if (pendientes.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        auto tarea = tomar(esPropio() ? indiceActual : 0);
+        if (!tarea) {
+            return false;
+        }
+        correr(*tarea);
+        return true;
+    }
+
+    inline void GrupoHilos::trabajar(std::size_t indice) {
+        grupoActual = this;
+        indiceActual = indice;
+        while (true) {
+            if (auto tarea = tomar(indice)) {
+                correr(*tarea);
+                continue;
+            }
+            std::uint32_t epoca = senal.load(std::memory_order_acquire);
+            if (pendientes.load(std::memory_order_acquire) > 0) {
+                continue;
+            }
+            if (detener.load(std::memory_order_acquire)) {
+                return;
+            }
+            senal.wait(epoca, std::memory_order_acquire);
+        }
+    }
+
+    /*
+     *  LoteTareas
+     */
+
+    template<typename T, typename E>
+        requires error_de_lote<E>
+    template<typename F>
+    void LoteTareas<T, E>::lanzar(F&& f) {
+        std::size_t indice = ranuras.size();
+        Ranura* ranura = &ranuras.emplace_back();
+        estado->pendientes.fetch_add(1, std::memory_order_relaxed);
+
+        grupo.ejecutar(Tarea([estado = estado, ranura, indice, f = std::forward<F>(f)]() mutable {
+            if (estado->cancelado.load(std::memory_order_relaxed)) {
+                ranura->resultado.emplace(en_error, E(RasgosError<E>::cancelado()));
+                ranura->cancelada = true;
+            } else {
+                try {
+                    TokenCancelacion token(estado->cancelado);
+                    if constexpr (std::is_invocable_v<F&, const TokenCancelacion&>) {
+                        ranura->resultado.emplace(std::invoke(f, token));
+                    } else {
+                        ranura->resultado.emplace(std::invoke(f));
+                    }
+                } catch (const std::exception& e) {
+                    ranura->resultado.emplace(en_error, E(RasgosError<E>::fatal(e.what())));
+                } catch (...) {
+                    ranura->resultado.emplace(en_error, E(RasgosError<E>::fatal({})));
+                }
+                const Resultado<T, E>& resultado = *ranura->resultado;
+                if (!resultado && RasgosError<E>::esFatal(resultado.Error())) {
+                    std::size_t esperado = SIN_FATAL;
+                    if (estado->fatal.compare_exchange_strong(esperado, indice, std::memory_order_relaxed)) {
+                        estado->cancelado.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+            if (estado->pendientes.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                estado->pendientes.notify_all();
+            }
+        }));
+    }
+
+    template<typename T, typename E>
+        requires error_de_lote<E>
+    void LoteTareas<T, E>::aguardar() {
+        std::size_t restantes = estado->pendientes.load(std::memory_order_acquire);
+        while (restantes != 0) {
+            if (!grupo.esPropio() || !grupo.ayudar()) {
+                estado->pendientes.wait(restantes, std::memory_order_acquire);
+            }
+            restantes = estado->pendientes.load(std::memory_order_acquire);
+        }
+    }
+
+    template<typename T, typename E>
+        requires error_de_lote<E>
+    ResumenLote<T, E> LoteTareas<T, E>::esperar() {
+        aguardar();
+        ResumenLote<T, E> resumen;
+        resumen.resultados.reserve(ranuras.size());
+        for (std::size_t i = 0; i < ranuras.size(); ++i) {
+            Resultado<T, E>& resultado = *ranuras[i].resultado;
+            if (ranuras[i].cancelada) {
+                ++resumen.canceladas;
+            } else if (!resultado && !RasgosError<E>::esFatal(resultado.Error())) {
+                resumen.errores.push_back(i);
+            }
+            resumen.resultados.push_back(std::move(resultado));
+        }
+        std::size_t fatal = estado->fatal.load(std::memory_order_relaxed);
+        if (fatal != SIN_FATAL) {
+            resumen.fatal = fatal;
+        }
+        ranuras.clear();
+        return resumen;
+    }
+
+    template<typename T, typename E>
+        requires error_de_lote<E>
+    LoteTareas<T, E>::~LoteTareas() {
+        // Las tareas escriben en `ranuras`: no pueden sobrevivir al lote.
+        aguardar();
+    }
+}
+#endif
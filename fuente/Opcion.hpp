@@ -1,23 +1,105 @@
 #ifndef OPCION_HPP
 #define OPCION_HPP
 
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <memory>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include <conceptos.hpp>
  
 namespace opc { // Declaración
+    /**
+    * @brief Rasgo que declara un valor centinela ("nicho") para `T`.
+    *
+    * Si `Centinela<T>` provee `vacio()` (el valor que representa la ausencia) y
+    * `esVacio(const T&)`, `Opcion<T>` codifica la ausencia en el propio valor y no
+    * necesita una bandera adicional: `sizeof(Opcion<T>) == sizeof(T)`.
+    *
+    * Está especializado para punteros desnudos e inteligentes (`nullptr`). Los
+    * usuarios pueden especializarlo para sus propios tipos, por ejemplo:
+    *
+    * ```cpp
+    * enum class Descriptor : int {};
+    * template<> struct opc::Centinela<Descriptor> : opc::CentinelaValor<Descriptor, Descriptor{-1}> {};
+    * ```
+    *
+    * @note Un valor igual al centinela almacenado en la opción la deja vacía.
+    * Especializarlo para un tipo fundamental (ej. `double`) afecta a todas las
+    * `Opcion` de ese tipo en el programa; se recomienda hacerlo sobre tipos propios.
+    */
+    template<typename T>
+    struct Centinela {};
+
+    // Centinela dado por un valor constante comparable por igualdad. Un NaN no es
+    // igual a sí mismo: si `V` es NaN, se reconoce cualquier NaN con `std::isnan`.
+    template<typename T, T V>
+    struct CentinelaValor {
+        static constexpr T vacio() noexcept { return V; };
+        static constexpr bool esVacio(const T& valor) noexcept {
+            if constexpr (std::is_floating_point_v<T>) {
+                if constexpr (V != V) {
+                    return std::isnan(valor);
+                }
+            }
+            return valor == V;
+        };
+    };
+
+    template<typename T> requires utiles::genericos::puntero_desnudo<T>
+    struct Centinela<T> : CentinelaValor<T, nullptr> {};
+
+    template<typename T> requires utiles::genericos::puntero_inteligente<T>
+    struct Centinela<T> {
+        static T vacio() noexcept { return nullptr; };
+        static bool esVacio(const T& valor) noexcept { return valor == nullptr; };
+    };
+
+    template<typename T>
+    concept con_centinela = requires(const T& valor) {
+        { Centinela<T>::vacio() } -> std::convertible_to<T>;
+        { Centinela<T>::esVacio(valor) } -> std::same_as<bool>;
+    };
+
+    // Valor trivialmente copiable y destructible: la opción también lo es.
+    template<typename T>
+    concept valor_trivial = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+    // Base sin métodos virtuales: no agrega vptr, por lo que `Opcion<T>` es
+    // trivialmente copiable y destructible siempre que `T` lo sea. El destructor
+    // es protegido para impedir la destrucción polimórfica.
     template<typename T>
     class OpcionBase {
     protected:
         bool vacia;
+        ~OpcionBase() noexcept = default;
     public:
         OpcionBase() noexcept : vacia(true) {}
-        virtual ~OpcionBase() noexcept = default;
+        OpcionBase(const OpcionBase&) noexcept = default;
+        OpcionBase(OpcionBase&&) noexcept = default;
+        OpcionBase& operator=(const OpcionBase&) noexcept = default;
+        OpcionBase& operator=(OpcionBase&&) noexcept = default;
         bool estaVacia() const noexcept { return vacia; };
         operator bool() noexcept { return !vacia; };
     };
 
+    // Con centinela la ausencia se codifica en el valor: la base no ocupa espacio
+    // y cada especialización de `Opcion` provee `estaVacia()`.
+    template<typename T> requires con_centinela<T>
+    class OpcionBase<T> {
+    protected:
+        ~OpcionBase() noexcept = default;
+    public:
+        OpcionBase() noexcept = default;
+        OpcionBase(const OpcionBase&) noexcept = default;
+        OpcionBase(OpcionBase&&) noexcept = default;
+        OpcionBase& operator=(const OpcionBase&) noexcept = default;
+        OpcionBase& operator=(OpcionBase&&) noexcept = default;
+    };
+
     /**
     * @brief Estructura que representa un tipo de opción, que puede contener un
     * valor de tipo T o estar vacía (sin valor).
@@ -48,6 +130,12 @@ namespace opc { // Declaración
     * tupla de tipo `std::tuple<T, bool>`, donde el segundo valor (`bool`) indica
     * si la instancia contenía un valor válido.
     *
+    * **Disposición en memoria**: si `T` es trivialmente copiable y destructible,
+    * `Opcion<T>` también lo es; para valores de hasta 8 bytes ocupa a lo sumo 16
+    * bytes y se devuelve en registros (ABI System V x86-64). Si `T` declara un
+    * `Centinela` (todos los punteros lo hacen), la ausencia se codifica en el valor
+    * y `sizeof(Opcion<T>) == sizeof(T)`.
+    *
     * **Notas**:
     * - Si se utiliza un puntero desnudo, se recomienda envolverlo en un puntero
     * inteligente (por ejemplo, `std::unique_ptr`) para mejorar la seguridad y
@@ -56,8 +144,13 @@ namespace opc { // Declaración
     template <typename T> 
     struct Opcion : public OpcionBase<T>{
         private:
-        T data;
-        using OpcionBase<T>::vacia;  
+        // Con centinela siempre hay un `T` construido; sin él, sólo si la opción no está vacía.
+        union {
+            T data;
+        };
+
+        static T inicial() noexcept(utiles::genericos::con_constructor_por_defecto<T>);
+        bool construido() const noexcept;
 
         public:
         
@@ -67,8 +160,54 @@ namespace opc { // Declaración
         explicit Opcion() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
             requires utiles::genericos::con_constructor_por_defecto<T>;
         explicit Opcion(T data) noexcept;
-
+        // Construye el valor directamente en la opción a partir de `args`.
+        template<typename... Args>
+        explicit Opcion(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+
+        Opcion(const Opcion<T>&) requires valor_trivial<T> = default;
+        Opcion(const Opcion<T>& otra) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires (!valor_trivial<T> && std::is_copy_constructible_v<T>);
+        Opcion(Opcion<T>&&) requires valor_trivial<T> = default;
+        Opcion(Opcion<T>&& otra) noexcept(std::is_nothrow_move_constructible_v<T>)
+            requires (!valor_trivial<T> && std::is_move_constructible_v<T>);
+        Opcion& operator=(const Opcion<T>&) requires valor_trivial<T> = default;
+        Opcion& operator=(const Opcion<T>& otra)
+            requires (!valor_trivial<T> && std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>);
+        Opcion& operator=(Opcion<T>&&) requires valor_trivial<T> = default;
+        Opcion& operator=(Opcion<T>&& otra)
+            noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+            requires (!valor_trivial<T> && std::is_move_constructible_v<T> && std::is_move_assignable_v<T>);
+        ~Opcion() requires valor_trivial<T> = default;
+        ~Opcion() requires (!valor_trivial<T>);
+
+        bool estaVacia() const noexcept;
         T valorO(T porDefecto) const noexcept;
+
+        /**
+        * @brief Acceso al valor sin consumir la opción.
+        *
+        * Ni copian el valor ni arman una tupla. `Valor()` exige una opción no
+        * vacía (verificar antes con `estaVacia` u `operator bool`); sobre un
+        * temporal devuelve el valor movido. `si()` devuelve `nullptr` si está vacía.
+        */
+        const T& Valor() const & noexcept { return data; };
+        T& Valor() & noexcept { return data; };
+        T Valor() && noexcept(std::is_nothrow_move_constructible_v<T>) { return std::move(data); };
+        const T* si() const noexcept { return estaVacia() ? nullptr : &data; };
+        T* si() noexcept { return estaVacia() ? nullptr : &data; };
+
+        /**
+        * @brief Reemplaza el contenido construyendo un nuevo valor en su lugar.
+        *
+        * Destruye el valor actual y construye `T` directamente en la opción a
+        * partir de `args`, sin temporales ni copias. Admite tipos no movibles.
+        *
+        * Si la construcción lanza, la opción queda vacía y la excepción se propaga.
+        *
+        * @return Una referencia al valor construido.
+        */
+        template<typename... Args>
+        T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
         /**
         * @brief Consumir "eleva" el valor de la opción y la "consume" - transfiere la propiedad de la data subyacente si es un puntero.
         *
@@ -84,72 +223,122 @@ namespace opc { // Declaración
         * se realiza mediante un `std::move()`. Para punteros desnudos, se asigna `nullptr` a la opción
         * para evitar el doble manejo del recurso.
         *
+        * Sobre una opción temporal (o `std::move(opcion).Consumir()`) el valor se
+        * mueve en lugar de copiarse, lo que admite tipos sólo movibles.
+        *
         * @return Una tupla que contiene el valor de la opción (o un valor por
         * defecto) y un indicador de si la opción contenía un valor válido (`true` o
         * `false`).
         */
-        std::tuple<T, bool> Consumir() noexcept(utiles::genericos::con_constructor_por_defecto<T>)  
+        std::tuple<T, bool> Consumir() & noexcept(std::is_nothrow_copy_constructible_v<T>)  
+            requires utiles::genericos::con_constructor_por_defecto<T>;
+        std::tuple<T, bool> Consumir() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)  
             requires utiles::genericos::con_constructor_por_defecto<T>;
         
-        std::tuple<T, bool> Consumir(T porDefecto) noexcept  
+        std::tuple<T, bool> Consumir(T porDefecto) & noexcept(std::is_nothrow_copy_constructible_v<T>)  
+            requires utiles::genericos::sin_constructor_por_defecto<T>;
+        std::tuple<T, bool> Consumir(T porDefecto) && noexcept  
+            requires utiles::genericos::sin_constructor_por_defecto<T>;
+
+        /**
+        * @brief Mueve el valor fuera de la opción y la deja vacía.
+        *
+        * Equivale a `std::move(opcion).Consumir()` pero deja explícito que la
+        * opción queda vacía tras la llamada. No copia el valor.
+        *
+        * @return La misma tupla que `Consumir`.
+        */
+        std::tuple<T, bool> Extraer() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+            requires utiles::genericos::con_constructor_por_defecto<T>;
+        std::tuple<T, bool> Extraer(T porDefecto) noexcept
             requires utiles::genericos::sin_constructor_por_defecto<T>;
 
         operator bool() noexcept;
 
+        /**
+        * @brief Combinadores: encadenan operaciones sobre el valor sin desempacarlo.
+        *
+        * - `mapear(f)`: `Opcion<U>` con `f(valor)`, o vacía si esta lo está.
+        * - `yLuego(f)`: `f(valor)`, que devuelve una `Opcion<U>`, o vacía si esta lo está.
+        * - `oSino(f)`: esta opción si tiene valor; si no, `f()`, que devuelve una `Opcion<T>`.
+        *
+        * No arman tuplas ni copian el valor: `f` recibe una referencia (o el valor
+        * movido si la opción es un temporal) y cada etapa devuelve su opción por
+        * valor, de modo que una cadena se reduce a la misma cascada de `if` que
+        * se escribiría a mano.
+        */
+        template<typename F> auto mapear(F&& f) const &;
+        template<typename F> auto mapear(F&& f) &&;
+        template<typename F> auto yLuego(F&& f) const &;
+        template<typename F> auto yLuego(F&& f) &&;
+        template<typename F> Opcion<T> oSino(F&& f) const &;
+        template<typename F> Opcion<T> oSino(F&& f) &&;
+
         /**
         * @brief Operador de llamada "Consume" la Opcion.
         * @return Una tupla que contiene el valor de la opción (o un valor por
         * defecto) y un indicador de si la opción contenía un valor válido (`true` o
         * `false`).
         */
-        std::tuple<T, bool> operator()() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        std::tuple<T, bool> operator()() & noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires utiles::genericos::con_constructor_por_defecto<T>;
+        std::tuple<T, bool> operator()() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
             requires utiles::genericos::con_constructor_por_defecto<T>;
 
-        std::tuple<T, bool> operator()(T porDefecto) noexcept
+        std::tuple<T, bool> operator()(T porDefecto) & noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires utiles::genericos::sin_constructor_por_defecto<T>;
+        std::tuple<T, bool> operator()(T porDefecto) && noexcept
             requires utiles::genericos::sin_constructor_por_defecto<T>;
+
+        private:
+        void vaciar() noexcept;
     };
 
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
     struct Opcion<T> : public OpcionBase<T> {
         private:
         T data;
-        using OpcionBase<T>::vacia;
         
         public:
         explicit Opcion() noexcept;
         explicit Opcion(T data) noexcept;
 
         Opcion(const Opcion<T>&) = delete;
-        Opcion operator=(const Opcion<T>&) = delete;
+        Opcion& operator=(const Opcion<T>&) = delete;
 
-        Opcion(const Opcion<T>&& otro) noexcept;
-        Opcion& operator=(const Opcion<T>&& otro) noexcept;
+        Opcion(Opcion<T>&& otro) noexcept;
+        Opcion& operator=(Opcion<T>&& otro) noexcept;
 
         ~Opcion() noexcept;
+        bool estaVacia() const noexcept { return data == nullptr; };
         operator bool() noexcept;
-        T valorO(T porDefecto) const noexcept;
+        T valorO(T porDefecto) noexcept;
+        // Puntero prestado, o `nullptr` si está vacía. No cede la propiedad.
+        T si() const noexcept { return data; };
         std::tuple<T, bool> Consumir() noexcept;
         std::tuple<T, bool> operator()() noexcept;
     };
 
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    struct Opcion<T> : public OpcionBase<typename T::element_type> {
+    struct Opcion<T> : public OpcionBase<T> {
         private:
         T data;
-       using OpcionBase<typename T::element_type>::vacia;
         
         public:
         explicit Opcion() noexcept;
         explicit Opcion(T data) noexcept;
 
         Opcion(const Opcion<T>&) = delete;
-        Opcion operator=(const Opcion<T>&) = delete;
+        Opcion& operator=(const Opcion<T>&) = delete;
 
-        Opcion(const Opcion<T>&& otro) noexcept;
-        Opcion& operator=(const Opcion<T>&& otro) noexcept;
+        Opcion(Opcion<T>&& otro) noexcept;
+        Opcion& operator=(Opcion<T>&& otro) noexcept;
 
         ~Opcion() noexcept{};
+        bool estaVacia() const noexcept { return data == nullptr; };
         operator bool() noexcept;
+        // Puntero prestado al objeto apuntado, o `nullptr` si está vacía. No cede la propiedad.
+        typename T::element_type* si() const noexcept { return data.get(); };
         std::tuple<T, bool> Consumir() noexcept;
         std::tuple<T, bool> operator()() noexcept;
     };
@@ -157,45 +346,288 @@ namespace opc { // Declaración
 }
 
 namespace opc{ // Implementación
+    template <typename T>
+    T Opcion<T>::inicial() noexcept(utiles::genericos::con_constructor_por_defecto<T>) {
+        if constexpr (con_centinela<T>) {
+            return Centinela<T>::vacio();
+        } else {
+            return T{};
+        }
+    }
+
+    template <typename T>
+    bool Opcion<T>::construido() const noexcept {
+        if constexpr (con_centinela<T>) {
+            return true;
+        } else {
+            return !this->vacia;
+        }
+    }
+
     template <typename T>
     Opcion<T>::Opcion() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
         requires utiles::genericos::con_constructor_por_defecto<T> {
-        this->data = T{};  
-        this->vacia = true;
+        if constexpr (con_centinela<T>) {
+            std::construct_at(&this->data, Centinela<T>::vacio());
+        }
     }
 
     template <typename T>
-    Opcion<T>::Opcion(T data) noexcept{
-        this->data = data;
-        this->vacia = false;
+    Opcion<T>::Opcion(T data) noexcept
+        : data(std::move(data)) {
+        if constexpr (!con_centinela<T>) {
+            this->vacia = false;
+        }
+    }
+
+    template <typename T>
+    template <typename... Args>
+    Opcion<T>::Opcion(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+        : data(std::forward<Args>(args)...) {
+        if constexpr (!con_centinela<T>) {
+            this->vacia = false;
+        }
+    }
+
+    template <typename T>
+    Opcion<T>::Opcion(const Opcion<T>& otra) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        requires (!valor_trivial<T> && std::is_copy_constructible_v<T>)
+        : OpcionBase<T>(otra) {
+        if (otra.construido()) {
+            std::construct_at(&this->data, otra.data);
+        }
+    }
+
+    template <typename T>
+    Opcion<T>::Opcion(Opcion<T>&& otra) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires (!valor_trivial<T> && std::is_move_constructible_v<T>)
+        : OpcionBase<T>(std::move(otra)) {
+        if (otra.construido()) {
+            std::construct_at(&this->data, std::move(otra.data));
+        }
+    }
+
+    template <typename T>
+    Opcion<T>& Opcion<T>::operator=(const Opcion<T>& otra)
+        requires (!valor_trivial<T> && std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>) {
+        if (this == &otra) {
+            return *this;
+        }
+        if (!otra.construido()) {
+            vaciar();
+        } else if (construido()) {
+            this->data = otra.data;
+        } else {
+            // Sin centinela: `vacia` cambia recién cuando el valor quedó construido.
+            std::construct_at(&this->data, otra.data);
+            if constexpr (!con_centinela<T>) {
+                this->vacia = false;
+            }
+        }
+        return *this;
+    }
+
+    template <typename T>
+    Opcion<T>& Opcion<T>::operator=(Opcion<T>&& otra)
+        noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+        requires (!valor_trivial<T> && std::is_move_constructible_v<T> && std::is_move_assignable_v<T>) {
+        if (this == &otra) {
+            return *this;
+        }
+        if (!otra.construido()) {
+            vaciar();
+        } else if (construido()) {
+            this->data = std::move(otra.data);
+        } else {
+            std::construct_at(&this->data, std::move(otra.data));
+            if constexpr (!con_centinela<T>) {
+                this->vacia = false;
+            }
+        }
+        return *this;
+    }
+
+    template <typename T>
+    Opcion<T>::~Opcion() requires (!valor_trivial<T>) {
+        if (construido()) {
+            std::destroy_at(&this->data);
+        }
+    }
+
+    template <typename T>
+    template <typename... Args>
+    T& Opcion<T>::emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        if constexpr (con_centinela<T>) {
+            std::destroy_at(&this->data);
+            if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+                std::construct_at(&this->data, std::forward<Args>(args)...);
+            } else {
+                try {
+                    std::construct_at(&this->data, std::forward<Args>(args)...);
+                } catch (...) {
+                    std::construct_at(&this->data, Centinela<T>::vacio());
+                    throw;
+                }
+            }
+        } else {
+            // Si la construcción lanza, la opción queda vacía: no hay ningún `T` que destruir.
+            vaciar();
+            std::construct_at(&this->data, std::forward<Args>(args)...);
+            this->vacia = false;
+        }
+        return this->data;
+    }
+
+    template <typename T>
+    bool Opcion<T>::estaVacia() const noexcept {
+        if constexpr (con_centinela<T>) {
+            return Centinela<T>::esVacio(this->data);
+        } else {
+            return this->vacia;
+        }
+    }
+
+    template <typename T>
+    Opcion<T>::operator bool() noexcept {
+        return !this->estaVacia();
     }
 
     template<typename T>
-    std::tuple<T, bool> Opcion<T>::Consumir(T porDefecto) noexcept
+    void Opcion<T>::vaciar() noexcept {
+        if constexpr (con_centinela<T>) {
+            this->data = Centinela<T>::vacio();
+        } else if (!this->vacia) {
+            this->vacia = true;
+            std::destroy_at(&this->data);
+        }
+    }
+
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::Consumir(T porDefecto) & noexcept(std::is_nothrow_copy_constructible_v<T>)
         requires utiles::genericos::sin_constructor_por_defecto<T> {
         bool ok = !this->estaVacia();
         return std::make_tuple(ok ? this->data : porDefecto, ok);
     };
 
     template<typename T>
-    std::tuple<T, bool> Opcion<T>::Consumir() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+    std::tuple<T, bool> Opcion<T>::Consumir(T porDefecto) && noexcept
+        requires utiles::genericos::sin_constructor_por_defecto<T> {
+        return Extraer(std::move(porDefecto));
+    };
+
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::Consumir() & noexcept(std::is_nothrow_copy_constructible_v<T>)
         requires utiles::genericos::con_constructor_por_defecto<T> {
         bool ok = !this->estaVacia();
-        return std::make_tuple(ok ? this->data : T{}, ok);
+        return std::make_tuple(ok ? this->data : inicial(), ok);
     }
 
     template<typename T>
-    std::tuple<T, bool> Opcion<T>::operator()() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+    std::tuple<T, bool> Opcion<T>::Consumir() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        requires utiles::genericos::con_constructor_por_defecto<T> {
+        return Extraer();
+    }
+
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::Extraer() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        requires utiles::genericos::con_constructor_por_defecto<T> {
+        bool ok = !this->estaVacia();
+        std::tuple<T, bool> salida(ok ? std::move(this->data) : inicial(), ok);
+        vaciar();
+        return salida;
+    }
+
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::Extraer(T porDefecto) noexcept
+        requires utiles::genericos::sin_constructor_por_defecto<T> {
+        bool ok = !this->estaVacia();
+        std::tuple<T, bool> salida(ok ? std::move(this->data) : std::move(porDefecto), ok);
+        vaciar();
+        return salida;
+    }
+
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::operator()() & noexcept(std::is_nothrow_copy_constructible_v<T>)
         requires utiles::genericos::con_constructor_por_defecto<T> {
             return Consumir();
         }
 
     template<typename T>
-    std::tuple<T, bool> Opcion<T>::operator()(T porDefecto) noexcept
+    std::tuple<T, bool> Opcion<T>::operator()() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        requires utiles::genericos::con_constructor_por_defecto<T> {
+            return Extraer();
+        }
+
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::operator()(T porDefecto) & noexcept(std::is_nothrow_copy_constructible_v<T>)
         requires utiles::genericos::sin_constructor_por_defecto<T> {
             return Consumir(porDefecto);
         }
 
+    template<typename T>
+    std::tuple<T, bool> Opcion<T>::operator()(T porDefecto) && noexcept
+        requires utiles::genericos::sin_constructor_por_defecto<T> {
+            return Extraer(std::move(porDefecto));
+        }
+
+
+    template<typename T>
+    template<typename F>
+    auto Opcion<T>::mapear(F&& f) const & {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        if (this->estaVacia()) {
+            return Opcion<U>();
+        }
+        return Opcion<U>(std::invoke(std::forward<F>(f), this->data));
+    }
+
+    template<typename T>
+    template<typename F>
+    auto Opcion<T>::mapear(F&& f) && {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, T&&>>;
+        if (this->estaVacia()) {
+            return Opcion<U>();
+        }
+        return Opcion<U>(std::invoke(std::forward<F>(f), std::move(this->data)));
+    }
+
+    template<typename T>
+    template<typename F>
+    auto Opcion<T>::yLuego(F&& f) const & {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        if (this->estaVacia()) {
+            return R();
+        }
+        return R(std::invoke(std::forward<F>(f), this->data));
+    }
+
+    template<typename T>
+    template<typename F>
+    auto Opcion<T>::yLuego(F&& f) && {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, T&&>>;
+        if (this->estaVacia()) {
+            return R();
+        }
+        return R(std::invoke(std::forward<F>(f), std::move(this->data)));
+    }
+
+    template<typename T>
+    template<typename F>
+    Opcion<T> Opcion<T>::oSino(F&& f) const & {
+        if (!this->estaVacia()) {
+            return *this;
+        }
+        return std::invoke(std::forward<F>(f));
+    }
+
+    template<typename T>
+    template<typename F>
+    Opcion<T> Opcion<T>::oSino(F&& f) && {
+        if (!this->estaVacia()) {
+            return std::move(*this);
+        }
+        return std::invoke(std::forward<F>(f));
+    }
 
     template<typename T>
     T Opcion<T>::valorO(T porDefecto) const noexcept{
@@ -210,28 +642,25 @@ namespace opc{ // Implementación
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
     Opcion<T>::Opcion() noexcept{
         this->data = nullptr;
-        this->vacia = true;
     }
 
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
     Opcion<T>::Opcion(T data) noexcept{
         this->data = data;
-        this->vacia = false;
     }
 
     // Contructor std::move
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Opcion<T>::Opcion(const Opcion<T>&& otro) noexcept{
-        this->data = std::exchange(otro->data, nullptr);
-        this->vacia = std::exchange(otro->vacia, true);
+    Opcion<T>::Opcion(Opcion<T>&& otro) noexcept{
+        this->data = std::exchange(otro.data, nullptr);
     }
 
     // Asignación std::move
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Opcion<T>& Opcion<T>::operator=(const Opcion<T>&& otro) noexcept{
+    Opcion<T>& Opcion<T>::operator=(Opcion<T>&& otro) noexcept{
         if (this != &otro){
-            this->data = std::exchange(otro->data, nullptr);
-            this->vacia = std::exchange(otro->vacia, true);
+            delete this->data;
+            this->data = std::exchange(otro.data, nullptr);
         }
         return *this;
     }
@@ -242,11 +671,15 @@ namespace opc{ // Implementación
     }
 
 
+    template <typename T> requires utiles::genericos::puntero_desnudo<T>
+    Opcion<T>::operator bool() noexcept{
+        return !this->estaVacia();
+    }
+
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
     std::tuple<T, bool> Opcion<T>::Consumir() noexcept{
         bool ok = !this->estaVacia();
-        this->vacia = true;
-        return std::make_tuple(ok ? std::exchange(this->data,nullptr) : nullptr, ok);
+        return std::make_tuple(std::exchange(this->data,nullptr), ok);
     }
     
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
@@ -255,9 +688,8 @@ namespace opc{ // Implementación
     }
 
     template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    T Opcion<T>::valorO(T porDefecto) const noexcept{
+    T Opcion<T>::valorO(T porDefecto) noexcept{
         bool ok = !this->estaVacia();
-        this->vacia = true;
         return ok ? std::exchange(this->data,nullptr) : porDefecto;
     };
     /*
@@ -267,40 +699,39 @@ namespace opc{ // Implementación
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
     Opcion<T>::Opcion() noexcept{
         this->data = nullptr;
-        this->vacia = true;
     }
 
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
     Opcion<T>::Opcion(T data) noexcept{
         this->data = std::move(data);
-        this->vacia = false;
     }
 
     // Contructor std::move
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Opcion<T>::Opcion(const Opcion<T>&& otro) noexcept{
-        this->data = std::move(std::exchange(otro->data, nullptr));
-        this->vacia = std::exchange(otro->vacia, true);
+    Opcion<T>::Opcion(Opcion<T>&& otro) noexcept{
+        this->data = std::exchange(otro.data, nullptr);
     }
 
     // Asignación std::move
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Opcion<T>& Opcion<T>::operator=(const Opcion<T>&& otro) noexcept{
+    Opcion<T>& Opcion<T>::operator=(Opcion<T>&& otro) noexcept{
         if (this != &otro){
-            this->data = std::move(std::exchange(otro->data, nullptr));
-            this->vacia = std::exchange(otro->vacia, true);
+            this->data = std::exchange(otro.data, nullptr);
         }
         return *this;
     }
 
 
 
+    template <typename T> requires utiles::genericos::puntero_inteligente<T>
+    Opcion<T>::operator bool() noexcept{
+        return !this->estaVacia();
+    }
+
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
     std::tuple<T, bool> Opcion<T>::Consumir() noexcept{
         bool ok = !this->estaVacia();
-        this->vacia = true;
-        return std::make_tuple(ok ? std::move(this->data) : nullptr, ok);
-
+        return std::make_tuple(std::exchange(this->data, nullptr), ok);
     }
 
     template <typename T> requires utiles::genericos::puntero_inteligente<T>
@@ -0,0 +1,86 @@
+#ifndef OPCION_ATOMICA_HPP
+#define OPCION_ATOMICA_HPP
+
+#include <atomic>
+#include <tuple>
+#include <utility>
+
+#include <conceptos.hpp>
+#include "Opcion.hpp"
+
+namespace opc { // Declaración
+    /**
+    * @brief Ranura atómica que contiene un puntero propio o está vacía.
+    *
+    * Es la versión segura entre hilos de `Opcion<T*>`: sirve para pasar de un
+    * hilo a otro el último valor publicado (la última configuración, la última
+    * instantánea) sin mutex. Todas las operaciones son un único intercambio
+    * atómico, libre de bloqueo.
+    *
+    * La ranura es dueña de lo que contiene y lo libera al destruirse. Lo que sale
+    * de la ranura (el valor tomado o el reemplazado) se entrega como
+    * `Opcion<T*>`, que a su vez lo libera si nadie lo consume.
+    *
+    * @note Un hilo que `tomar` un valor es su único dueño: la ranura no admite
+    * lectores que consulten el valor sin tomarlo.
+    */
+    template<typename T> requires utiles::genericos::puntero_desnudo<T>
+    class OpcionAtomica {
+        static_assert(std::atomic<T>::is_always_lock_free, "OpcionAtomica requiere punteros atómicos libres de bloqueo");
+
+        public:
+        OpcionAtomica() noexcept : ranura(nullptr) {};
+        explicit OpcionAtomica(T valor) noexcept : ranura(valor) {};
+        ~OpcionAtomica() noexcept { delete ranura.load(std::memory_order_acquire); };
+        OpcionAtomica(const OpcionAtomica&) = delete;
+        OpcionAtomica& operator=(const OpcionAtomica&) = delete;
+
+        // Publica `valor`, del que pasa a ser dueña. Devuelve el valor reemplazado, si había.
+        Opcion<T> publicar(T valor) noexcept;
+        // Toma el valor y deja la ranura vacía.
+        Opcion<T> tomar() noexcept;
+        /**
+        * @brief Publica `nuevo` sólo si la ranura contiene `esperado`.
+        *
+        * Si lo logra, la ranura pasa a ser dueña del valor de `nuevo` y `nuevo`
+        * recibe el valor reemplazado (el `esperado`). Si no, `esperado` se
+        * actualiza con el contenido actual y `nuevo` queda intacto, listo para
+        * reintentar.
+        */
+        bool compararYPublicar(T& esperado, Opcion<T>& nuevo) noexcept;
+
+        bool estaVacia() const noexcept { return ranura.load(std::memory_order_relaxed) == nullptr; };
+
+        private:
+        std::atomic<T> ranura;
+    };
+}
+
+namespace opc { // Implementación
+    template<typename T> requires utiles::genericos::puntero_desnudo<T>
+    Opcion<T> OpcionAtomica<T>::publicar(T valor) noexcept {
+        // `release` publica el contenido del valor nuevo; `acquire` hace visible el del anterior.
+        return Opcion<T>(ranura.exchange(valor, std::memory_order_acq_rel));
+    }
+
+    template<typename T> requires utiles::genericos::puntero_desnudo<T>
+    Opcion<T> OpcionAtomica<T>::tomar() noexcept {
+        // Se evita la escritura (y la invalidación de la línea de caché) si ya está vacía.
+        if (ranura.load(std::memory_order_relaxed) == nullptr) {
+            return Opcion<T>();
+        }
+        return Opcion<T>(ranura.exchange(nullptr, std::memory_order_acquire));
+    }
+
+    template<typename T> requires utiles::genericos::puntero_desnudo<T>
+    bool OpcionAtomica<T>::compararYPublicar(T& esperado, Opcion<T>& nuevo) noexcept {
+        T valor = std::get<0>(nuevo.Consumir());
+        if (ranura.compare_exchange_strong(esperado, valor, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            nuevo = Opcion<T>(esperado);
+            return true;
+        }
+        nuevo = Opcion<T>(valor);
+        return false;
+    }
+}
+#endif
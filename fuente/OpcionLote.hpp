@@ -0,0 +1,283 @@
+#ifndef OPCION_LOTE_HPP
+#define OPCION_LOTE_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <conceptos.hpp>
+#include "Opcion.hpp"
+#include "Simd.hpp"
+
+namespace opc { // Declaración
+    /**
+    * @brief Mapa de bits compacto: un bit por elemento, en palabras de 64 bits.
+    *
+    * Los bits más allá de `tamano()` en la última palabra siempre valen cero, de
+    * modo que contar y recorrer pueden operar por palabras completas.
+    */
+    class MapaBits {
+        public:
+        MapaBits() noexcept = default;
+        explicit MapaBits(std::size_t tamano, bool valor = false);
+
+        std::size_t tamano() const noexcept { return cantidad; };
+        void reservar(std::size_t tamano) { palabras.reserve((tamano + 63) / 64); };
+
+        bool leer(std::size_t i) const noexcept { return (palabras[i / 64] >> (i % 64)) & 1u; };
+        void poner(std::size_t i) noexcept { palabras[i / 64] |= std::uint64_t{1} << (i % 64); };
+        void quitar(std::size_t i) noexcept { palabras[i / 64] &= ~(std::uint64_t{1} << (i % 64)); };
+        void agregar(bool valor);
+        // Agrega al final los bits de `otro`.
+        void anexar(const MapaBits& otro);
+
+        // Cantidad de bits en uno.
+        std::size_t contar() const noexcept;
+        // Intersección de mapas del mismo tamaño: presentes en todos (p. ej., filas válidas en todas las columnas).
+        template<std::same_as<MapaBits>... M>
+        static MapaBits interseccion(const MapaBits& primero, const M&... resto);
+        // Llama a `f(i)` para cada bit en uno, en orden creciente.
+        template<typename F>
+        void paraCadaUno(F&& f) const;
+
+        const std::vector<std::uint64_t>& datos() const noexcept { return palabras; };
+
+        private:
+        std::vector<std::uint64_t> palabras;
+        std::size_t cantidad = 0;
+    };
+
+    // Valores directos con constructor por defecto: las posiciones vacías guardan `T{}`.
+    // Los punteros quedan excluidos porque `Opcion` de un puntero es dueña de lo apuntado.
+    template<typename T>
+    concept valor_en_lote = utiles::genericos::con_constructor_por_defecto<T>
+        && !utiles::genericos::puntero_desnudo<T> && !utiles::genericos::puntero_inteligente<T>;
+
+    /**
+    * @brief Lote columnar de opciones: valores contiguos y un mapa de presencia.
+    *
+    * Equivale a un `std::vector<Opcion<T>>`, pero guarda los valores en un arreglo
+    * denso y la presencia en un bit por elemento: ocupa `sizeof(T)` más un bit por
+    * elemento, contra `sizeof(Opcion<T>)` (16 bytes para un `double`). Las
+    * posiciones vacías guardan `T{}`.
+    *
+    * Las operaciones masivas (`contarPresentes`, `valorO`, `compactar`,
+    * `paraCadaPresente`) recorren el mapa por palabras de 64 bits, saltando de a
+    * 64 elementos vacíos por vez.
+    */
+    template<typename T> requires valor_en_lote<T>
+    class OpcionLote {
+        public:
+        OpcionLote() = default;
+        // `tamano` opciones vacías.
+        explicit OpcionLote(std::size_t tamano) : valores(tamano), presentes(tamano) {};
+        explicit OpcionLote(const std::vector<Opcion<T>>& opciones);
+
+        std::size_t tamano() const noexcept { return valores.size(); };
+        void reservar(std::size_t tamano);
+
+        void agregar(T valor);
+        void agregarVacia();
+        void agregar(const Opcion<T>& opcion);
+
+        bool presente(std::size_t i) const noexcept { return presentes.leer(i); };
+        // El elemento `i`, como opción.
+        Opcion<T> operator[](std::size_t i) const;
+        void asignar(std::size_t i, T valor);
+        void vaciar(std::size_t i);
+
+        std::size_t contarPresentes() const noexcept { return presentes.contar(); };
+        // Todos los valores, con `porDefecto` en las posiciones vacías (el `valorO` de cada elemento).
+        std::vector<T> valorO(const T& porDefecto) const;
+        // Sólo los valores presentes, en orden.
+        std::vector<T> compactar() const;
+        // Llama a `f(i, valor)` para cada elemento presente, en orden.
+        template<typename F>
+        void paraCadaPresente(F&& f) const;
+
+        std::vector<Opcion<T>> aOpciones() const;
+
+        // Acceso directo a las columnas, para operar sobre ellas en bloque.
+        const std::vector<T>& datos() const noexcept { return valores; };
+        const MapaBits& mapa() const noexcept { return presentes; };
+
+        private:
+        std::vector<T> valores;
+        MapaBits presentes;
+    };
+}
+
+namespace opc { // Implementación
+    /*
+     *  MapaBits
+     */
+
+    inline MapaBits::MapaBits(std::size_t tamano, bool valor)
+        : palabras((tamano + 63) / 64, valor ? ~std::uint64_t{0} : 0), cantidad(tamano) {
+        if (valor && tamano % 64 != 0) {
+            palabras.back() = (std::uint64_t{1} << (tamano % 64)) - 1;
+        }
+    }
+
+    inline void MapaBits::agregar(bool valor) {
+        if (cantidad % 64 == 0) {
+            palabras.push_back(0);
+        }
+        if (valor) {
+            palabras.back() |= std::uint64_t{1} << (cantidad % 64);
+        }
+        ++cantidad;
+    }
+
+    inline void MapaBits::anexar(const MapaBits& otro) {
+        std::size_t corrimiento = cantidad % 64;
+        if (corrimiento == 0) {
+            palabras.insert(palabras.end(), otro.palabras.begin(), otro.palabras.end());
+        } else {
+            // Cada palabra de `otro` se reparte entre el final de la última palabra y una nueva.
+            for (std::uint64_t palabra : otro.palabras) {
+                palabras.back() |= palabra << corrimiento;
+                palabras.push_back(palabra >> (64 - corrimiento));
+            }
+        }
+        cantidad += otro.cantidad;
+        palabras.resize((cantidad + 63) / 64);
+    }
+
+    inline std::size_t MapaBits::contar() const noexcept {
+        return simd::contarBits(palabras.data(), palabras.size());
+    }
+
+    template<std::same_as<MapaBits>... M>
+    MapaBits MapaBits::interseccion(const MapaBits& primero, const M&... resto) {
+        const std::uint64_t* mapas[] = {primero.palabras.data(), resto.palabras.data()...};
+        MapaBits resultado;
+        resultado.cantidad = primero.cantidad;
+        resultado.palabras.resize(primero.palabras.size());
+        simd::combinarMapas(resultado.palabras.data(), mapas, sizeof...(M) + 1, resultado.palabras.size());
+        return resultado;
+    }
+
+    template<typename F>
+    void MapaBits::paraCadaUno(F&& f) const {
+        for (std::size_t p = 0; p < palabras.size(); ++p) {
+            std::uint64_t palabra = palabras[p];
+            while (palabra != 0) {
+                f(p * 64 + static_cast<std::size_t>(std::countr_zero(palabra)));
+                palabra &= palabra - 1;
+            }
+        }
+    }
+
+    /*
+     *  OpcionLote
+     */
+
+    template<typename T> requires valor_en_lote<T>
+    OpcionLote<T>::OpcionLote(const std::vector<Opcion<T>>& opciones) {
+        reservar(opciones.size());
+        for (const auto& opcion : opciones) {
+            agregar(opcion);
+        }
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    void OpcionLote<T>::reservar(std::size_t tamano) {
+        valores.reserve(tamano);
+        presentes.reservar(tamano);
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    void OpcionLote<T>::agregar(T valor) {
+        valores.push_back(std::move(valor));
+        presentes.agregar(true);
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    void OpcionLote<T>::agregarVacia() {
+        valores.emplace_back();
+        presentes.agregar(false);
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    void OpcionLote<T>::agregar(const Opcion<T>& opcion) {
+        if (opcion.estaVacia()) {
+            agregarVacia();
+        } else {
+            agregar(opcion.Valor());
+        }
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    Opcion<T> OpcionLote<T>::operator[](std::size_t i) const {
+        return presente(i) ? Opcion<T>(valores[i]) : Opcion<T>();
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    void OpcionLote<T>::asignar(std::size_t i, T valor) {
+        valores[i] = std::move(valor);
+        presentes.poner(i);
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    void OpcionLote<T>::vaciar(std::size_t i) {
+        valores[i] = T{};
+        presentes.quitar(i);
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    std::vector<T> OpcionLote<T>::valorO(const T& porDefecto) const {
+        std::vector<T> salida(valores);
+        if constexpr (simd::elemento_simd<T>) {
+            simd::rellenar(salida.data(), presentes.datos().data(), salida.size(), porDefecto);
+            return salida;
+        }
+        const auto& palabras = presentes.datos();
+        for (std::size_t p = 0; p < palabras.size(); ++p) {
+            // Sólo se tocan las posiciones vacías; una palabra llena se saltea entera.
+            std::uint64_t vacias = ~palabras[p];
+            if (p + 1 == palabras.size() && valores.size() % 64 != 0) {
+                vacias &= (std::uint64_t{1} << (valores.size() % 64)) - 1;
+            }
+            while (vacias != 0) {
+                salida[p * 64 + static_cast<std::size_t>(std::countr_zero(vacias))] = porDefecto;
+                vacias &= vacias - 1;
+            }
+        }
+        return salida;
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    std::vector<T> OpcionLote<T>::compactar() const {
+        std::vector<T> salida;
+        if constexpr (simd::elemento_simd<T>) {
+            // Los núcleos vectoriales escriben de a bloques: necesitan lugar para todos.
+            salida.resize(valores.size());
+            salida.resize(simd::compactar(valores.data(), presentes.datos().data(), valores.size(), salida.data()));
+            return salida;
+        }
+        salida.reserve(contarPresentes());
+        presentes.paraCadaUno([&](std::size_t i) { salida.push_back(valores[i]); });
+        return salida;
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    template<typename F>
+    void OpcionLote<T>::paraCadaPresente(F&& f) const {
+        presentes.paraCadaUno([&](std::size_t i) { f(i, valores[i]); });
+    }
+
+    template<typename T> requires valor_en_lote<T>
+    std::vector<Opcion<T>> OpcionLote<T>::aOpciones() const {
+        std::vector<Opcion<T>> opciones;
+        opciones.reserve(valores.size());
+        for (std::size_t i = 0; i < valores.size(); ++i) {
+            opciones.push_back((*this)[i]);
+        }
+        return opciones;
+    }
+}
+#endif
@@ -0,0 +1,309 @@
+#ifndef RECOLECCION_HPP
+#define RECOLECCION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <conceptos.hpp>
+#include "Error.hpp"
+#include "Resultado.hpp"
+#include "ResultadoAsync.hpp"
+#include "GrupoHilos.hpp"
+
+namespace res { // Declaración
+    // Valores y errores de un conjunto de resultados, cada uno en el orden de entrada.
+    template<typename T, typename E = err::Error>
+    struct Particion {
+        std::vector<T> valores;
+        std::vector<E> errores;
+    };
+
+    /**
+    * @brief Todos los valores en orden, o el primer error.
+    *
+    * Recorre los resultados una sola vez y se detiene en el primer error. La
+    * salida se reserva de antemano. Sobre un temporal, los valores se mueven.
+    *
+    * Con un `GrupoHilos`, la entrada se reparte en tramos contiguos entre sus
+    * hilos. El error devuelto es el mismo que en la versión secuencial (el de
+    * menor índice): un tramo deja de trabajar en cuanto otro encontró un error
+    * antes que su posición actual.
+    */
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(std::vector<Resultado<T, E>>&& resultados);
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(const std::vector<Resultado<T, E>>& resultados);
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(std::vector<Resultado<T, E>>&& resultados, GrupoHilos& grupo);
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(const std::vector<Resultado<T, E>>& resultados, GrupoHilos& grupo);
+
+    /**
+    * @brief Separa valores y errores, conservando el orden de cada uno.
+    *
+    * Con un `GrupoHilos`, cada tramo separa los suyos y luego se concatenan en
+    * orden: el resultado es idéntico al de la versión secuencial.
+    */
+    template<typename T, typename E>
+    Particion<T, E> particionar(std::vector<Resultado<T, E>>&& resultados);
+    template<typename T, typename E>
+    Particion<T, E> particionar(const std::vector<Resultado<T, E>>& resultados);
+    template<typename T, typename E>
+    Particion<T, E> particionar(std::vector<Resultado<T, E>>&& resultados, GrupoHilos& grupo);
+    template<typename T, typename E>
+    Particion<T, E> particionar(const std::vector<Resultado<T, E>>& resultados, GrupoHilos& grupo);
+}
+
+namespace res { // Implementación
+    namespace detalle {
+        // Por debajo de este tamaño de tramo, repartir cuesta más de lo que ahorra.
+        inline constexpr std::size_t TRAMO_MINIMO = 16 * 1024;
+
+        // El valor de un resultado exitoso: movido, o por referencia para copiarlo.
+        template<bool Mover, typename R>
+        decltype(auto) tomarValor(R& resultado) {
+            if constexpr (Mover) {
+                return extraerValor(resultado);
+            } else {
+                return std::as_const(resultado).Valor();
+            }
+        }
+
+        // Cantidad de tramos en que conviene dividir `total` elementos; 1 si no conviene repartir.
+        inline std::size_t cantidadTramos(std::size_t total, const GrupoHilos& grupo) noexcept {
+            if (grupo.tamano() == 1) {
+                return 1;
+            }
+            std::size_t tramos = std::min(grupo.tamano() * 4, total / TRAMO_MINIMO);
+            return std::max<std::size_t>(tramos, 1);
+        }
+
+        // Ejecuta `f(tramo, desde, hasta)` para cada tramo en el grupo y espera a todos.
+        template<typename F>
+        void repartir(GrupoHilos& grupo, std::size_t total, std::size_t tramos, F& f) {
+            // La excepción de cada tramo, para relanzarla intacta en quien llamó.
+            std::vector<std::exception_ptr> excepciones(tramos);
+            LoteTareas<std::size_t> lote(grupo);
+            for (std::size_t t = 0; t < tramos; ++t) {
+                std::size_t desde = total * t / tramos;
+                std::size_t hasta = total * (t + 1) / tramos;
+                lote.lanzar([&f, &excepciones, t, desde, hasta]() {
+                    try {
+                        f(t, desde, hasta);
+                    } catch (...) {
+                        excepciones[t] = std::current_exception();
+                        return Resultado<std::size_t>(en_error, err::Fatal());
+                    }
+                    return Resultado<std::size_t>(t);
+                });
+            }
+            auto resumen = lote.esperar();
+            if (resumen.fatal) {
+                // Una excepción en algún tramo (al copiar o reservar): se relanza en quien llamó.
+                std::rethrow_exception(excepciones[*resumen.fatal]);
+            }
+        }
+
+        template<bool Mover, typename T, typename E, typename V>
+        Resultado<std::vector<T>, E> recolectarSecuencial(V& resultados) {
+            std::vector<T> valores;
+            valores.reserve(resultados.size());
+            for (auto& resultado : resultados) {
+                if (!resultado) {
+                    return Resultado<std::vector<T>, E>(en_error, E(resultado.Error()));
+                }
+                valores.push_back(tomarValor<Mover>(resultado));
+            }
+            return Resultado<std::vector<T>, E>(std::move(valores));
+        }
+
+        template<bool Mover, typename T, typename E, typename V>
+        Resultado<std::vector<T>, E> recolectarParalelo(V& resultados, GrupoHilos& grupo) {
+            const std::size_t total = resultados.size();
+            const std::size_t tramos = cantidadTramos(total, grupo);
+            if (tramos == 1) {
+                return recolectarSecuencial<Mover, T, E>(resultados);
+            }
+
+            std::atomic<std::size_t> primerError{total};
+            auto registrarError = [&primerError](std::size_t i) {
+                std::size_t actual = primerError.load(std::memory_order_relaxed);
+                while (i < actual && !primerError.compare_exchange_weak(actual, i, std::memory_order_relaxed)) {}
+            };
+            // Cada 1024 elementos, el tramo verifica si ya hay un error antes de su posición.
+            auto superado = [&primerError](std::size_t i) {
+                return (i & 1023) == 0 && primerError.load(std::memory_order_relaxed) < i;
+            };
+
+            std::vector<T> valores;
+            if constexpr (utiles::genericos::con_constructor_por_defecto<T>) {
+                // Cada tramo escribe directamente en su porción de la salida.
+                valores.resize(total);
+                auto tramo = [&](std::size_t, std::size_t desde, std::size_t hasta) {
+                    for (std::size_t i = desde; i < hasta; ++i) {
+                        if (superado(i)) return;
+                        auto& resultado = resultados[i];
+                        if (!resultado) { registrarError(i); return; }
+                        valores[i] = tomarValor<Mover>(resultado);
+                    }
+                };
+                repartir(grupo, total, tramos, tramo);
+            } else {
+                // Sin constructor por defecto: cada tramo junta los suyos y se concatenan al final.
+                std::vector<std::vector<T>> parciales(tramos);
+                auto tramo = [&](std::size_t t, std::size_t desde, std::size_t hasta) {
+                    parciales[t].reserve(hasta - desde);
+                    for (std::size_t i = desde; i < hasta; ++i) {
+                        if (superado(i)) return;
+                        auto& resultado = resultados[i];
+                        if (!resultado) { registrarError(i); return; }
+                        parciales[t].push_back(tomarValor<Mover>(resultado));
+                    }
+                };
+                repartir(grupo, total, tramos, tramo);
+                if (primerError.load(std::memory_order_relaxed) == total) {
+                    valores.reserve(total);
+                    for (auto& parcial : parciales) {
+                        std::move(parcial.begin(), parcial.end(), std::back_inserter(valores));
+                    }
+                }
+            }
+
+            std::size_t error = primerError.load(std::memory_order_relaxed);
+            if (error != total) {
+                return Resultado<std::vector<T>, E>(en_error, E(resultados[error].Error()));
+            }
+            return Resultado<std::vector<T>, E>(std::move(valores));
+        }
+
+        template<bool Mover, typename T, typename E, typename V>
+        void particionarTramo(V& resultados, std::size_t desde, std::size_t hasta, Particion<T, E>& salida) {
+            for (std::size_t i = desde; i < hasta; ++i) {
+                auto& resultado = resultados[i];
+                if (resultado) {
+                    salida.valores.push_back(tomarValor<Mover>(resultado));
+                } else {
+                    salida.errores.push_back(resultado.Error());
+                }
+            }
+        }
+
+        template<bool Mover, typename T, typename E, typename V>
+        Particion<T, E> particionarSecuencial(V& resultados) {
+            Particion<T, E> particion;
+            particion.valores.reserve(resultados.size());
+            particionarTramo<Mover>(resultados, 0, resultados.size(), particion);
+            return particion;
+        }
+
+        template<bool Mover, typename T, typename E, typename V>
+        Particion<T, E> particionarParalelo(V& resultados, GrupoHilos& grupo) {
+            const std::size_t total = resultados.size();
+            const std::size_t tramos = cantidadTramos(total, grupo);
+            if (tramos == 1) {
+                return particionarSecuencial<Mover, T, E>(resultados);
+            }
+
+            Particion<T, E> particion;
+            if constexpr (utiles::genericos::con_constructor_por_defecto<T> && utiles::genericos::con_constructor_por_defecto<E>) {
+                // Dos pasadas: cada tramo cuenta sus errores y luego escribe
+                // directamente en su posición final, sin concatenar.
+                std::vector<std::size_t> errores(tramos + 1, 0);
+                auto contar = [&](std::size_t t, std::size_t desde, std::size_t hasta) {
+                    std::size_t cuenta = 0;
+                    for (std::size_t i = desde; i < hasta; ++i) {
+                        cuenta += !resultados[i];
+                    }
+                    errores[t + 1] = cuenta;
+                };
+                repartir(grupo, total, tramos, contar);
+                for (std::size_t t = 0; t < tramos; ++t) {
+                    errores[t + 1] += errores[t];
+                }
+
+                particion.valores.resize(total - errores[tramos]);
+                particion.errores.resize(errores[tramos]);
+                auto escribir = [&](std::size_t t, std::size_t desde, std::size_t hasta) {
+                    std::size_t valor = desde - errores[t], error = errores[t];
+                    for (std::size_t i = desde; i < hasta; ++i) {
+                        auto& resultado = resultados[i];
+                        if (resultado) {
+                            particion.valores[valor++] = tomarValor<Mover>(resultado);
+                        } else {
+                            particion.errores[error++] = resultado.Error();
+                        }
+                    }
+                };
+                repartir(grupo, total, tramos, escribir);
+            } else {
+                // Sin constructores por defecto: cada tramo separa los suyos y se concatenan al final.
+                std::vector<Particion<T, E>> parciales(tramos);
+                auto tramo = [&](std::size_t t, std::size_t desde, std::size_t hasta) {
+                    parciales[t].valores.reserve(hasta - desde);
+                    particionarTramo<Mover>(resultados, desde, hasta, parciales[t]);
+                };
+                repartir(grupo, total, tramos, tramo);
+
+                std::size_t cantidadValores = 0, cantidadErrores = 0;
+                for (const auto& parcial : parciales) {
+                    cantidadValores += parcial.valores.size();
+                    cantidadErrores += parcial.errores.size();
+                }
+                particion.valores.reserve(cantidadValores);
+                particion.errores.reserve(cantidadErrores);
+                for (auto& parcial : parciales) {
+                    std::move(parcial.valores.begin(), parcial.valores.end(), std::back_inserter(particion.valores));
+                    std::move(parcial.errores.begin(), parcial.errores.end(), std::back_inserter(particion.errores));
+                }
+            }
+            return particion;
+        }
+    }
+
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(std::vector<Resultado<T, E>>&& resultados) {
+        return detalle::recolectarSecuencial<true, T, E>(resultados);
+    }
+
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(const std::vector<Resultado<T, E>>& resultados) {
+        return detalle::recolectarSecuencial<false, T, E>(resultados);
+    }
+
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(std::vector<Resultado<T, E>>&& resultados, GrupoHilos& grupo) {
+        return detalle::recolectarParalelo<true, T, E>(resultados, grupo);
+    }
+
+    template<typename T, typename E>
+    Resultado<std::vector<T>, E> recolectar(const std::vector<Resultado<T, E>>& resultados, GrupoHilos& grupo) {
+        return detalle::recolectarParalelo<false, T, E>(resultados, grupo);
+    }
+
+    template<typename T, typename E>
+    Particion<T, E> particionar(std::vector<Resultado<T, E>>&& resultados) {
+        return detalle::particionarSecuencial<true, T, E>(resultados);
+    }
+
+    template<typename T, typename E>
+    Particion<T, E> particionar(const std::vector<Resultado<T, E>>& resultados) {
+        return detalle::particionarSecuencial<false, T, E>(resultados);
+    }
+
+    template<typename T, typename E>
+    Particion<T, E> particionar(std::vector<Resultado<T, E>>&& resultados, GrupoHilos& grupo) {
+        return detalle::particionarParalelo<true, T, E>(resultados, grupo);
+    }
+
+    template<typename T, typename E>
+    Particion<T, E> particionar(const std::vector<Resultado<T, E>>& resultados, GrupoHilos& grupo) {
+        return detalle::particionarParalelo<false, T, E>(resultados, grupo);
+    }
+}
+#endif
@@ -1,25 +1,189 @@
 #ifndef RESULTADO_HPP
 #define RESULTADO_HPP
 
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include <conceptos.hpp>
 #include "Error.hpp"
 
 namespace res { //Declaración
-    template<typename T>
+    /**
+    * @brief Rasgos del tipo de error `E` de un `Resultado<T, E>`.
+    *
+    * Indican qué valor de `E` representa el éxito y cuándo un valor es un error.
+    * Por defecto, el éxito es `E{}` (el valor inicializado a cero, p. ej. el
+    * primer enumerador de un `enum` con valor `0`) y un valor es un error si es
+    * distinto de `E{}` (enumeraciones) o si es verdadero en contexto booleano.
+    *
+    * Opcionalmente pueden proveer `movido()`, el estado en que quedan las
+    * especializaciones de punteros luego de moverse o consumirse.
+    * `ResultadoAsync` requiere además `cancelado()` y `abandonado()`: el error
+    * con que se completa una operación cancelada o cuya promesa se destruyó.
+    * `LoteTareas` requiere también `esFatal(e)`, si el error cancela el lote, y
+    * `fatal(mensaje)`, el error de una tarea de la que escapó una excepción.
+    */
+    template<typename E>
+    struct RasgosError {
+        static constexpr E exito() noexcept { return E{}; };
+        static constexpr bool esError(const E& e) noexcept {
+            if constexpr (std::is_enum_v<E>) {
+                return e != E{};
+            } else {
+                return static_cast<bool>(e);
+            }
+        };
+    };
+
+    template<>
+    struct RasgosError<err::Error> {
+        static err::Error exito() noexcept { return err::Error(err::catalogo::EXITO); };
+        static bool esError(const err::Error& e) noexcept { return e.Codigo() != err::EXITO; };
+        static err::Error movido() noexcept { return err::Error(err::catalogo::MOVIDO); };
+        static err::Error cancelado() noexcept { return err::Error(err::catalogo::CANCELADO); };
+        static err::Error abandonado() noexcept { return err::Error(err::catalogo::ABANDONADO); };
+        static bool esFatal(const err::Error& e) noexcept { return e.Codigo() == err::FATAL; };
+        static err::Error fatal(std::string_view mensaje) {
+            return mensaje.empty() ? err::Fatal() : err::Fatal(std::string(mensaje));
+        };
+    };
+
+    template<>
+    struct RasgosError<err::ErrorEstatico> {
+        static constexpr err::ErrorEstatico exito() noexcept { return err::catalogo::EXITO; };
+        static constexpr bool esError(const err::ErrorEstatico& e) noexcept { return static_cast<bool>(e); };
+        static constexpr err::ErrorEstatico movido() noexcept { return err::catalogo::MOVIDO; };
+        static constexpr err::ErrorEstatico cancelado() noexcept { return err::catalogo::CANCELADO; };
+        static constexpr err::ErrorEstatico abandonado() noexcept { return err::catalogo::ABANDONADO; };
+        static constexpr bool esFatal(const err::ErrorEstatico& e) noexcept { return e.Codigo() == err::FATAL; };
+        // Sin memoria propia: el mensaje de la excepción se pierde.
+        static constexpr err::ErrorEstatico fatal(std::string_view) noexcept { return err::catalogo::FATAL; };
+    };
+
+    /**
+    * @brief Etiqueta para construir un resultado fallido: `Resultado<T, E>(res::en_error, e)`.
+    *
+    * Evita que el error se confunda con el valor cuando `T` y `E` son el mismo
+    * tipo o se convierten entre sí (p. ej. `Resultado<long, int>`).
+    */
+    struct error_t {
+        explicit error_t() = default;
+    };
+    inline constexpr error_t en_error{};
+
+    // Los errores de la biblioteca se convierten a `bool` y a texto sólo para diagnóstico:
+    // un argumento de ese tipo nunca es el valor de un resultado.
+    template<typename E>
+    concept error_de_biblioteca = std::same_as<E, err::Error> || std::same_as<E, err::ErrorEstatico>;
+
+    // `T` y `E` no pueden confundirse: distintos y sin conversión implícita entre ellos.
+    // Sólo entonces se admite construir un resultado fallido sin `en_error`.
+    template<typename T, typename E>
+    concept error_inequivoco = !std::same_as<T, E>
+        && (error_de_biblioteca<E> || (!std::convertible_to<E, T> && !std::convertible_to<T, E>));
+
+    // Valor y error trivialmente copiables y destructibles: el almacenamiento también lo es.
+    template<typename T, typename E>
+    concept almacen_trivial =
+        std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T> &&
+        std::is_trivially_copyable_v<E> && std::is_trivially_destructible_v<E>;
+
+    template<typename T, typename E>
+    concept almacen_copiable = std::is_copy_constructible_v<T> && std::is_copy_constructible_v<E>;
+
+    // Mover el valor o el error no lanza.
+    template<typename T, typename E>
+    concept movimiento_seguro = std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>;
+
+    /**
+    * @brief Almacenamiento de un resultado: el valor **o** el error, nunca ambos.
+    *
+    * El valor y el error comparten memoria en una unión discriminada; sólo el
+    * miembro activo está construido. Un resultado exitoso no carga un `E` y uno
+    * fallido no construye un `T`, por lo que `T` no necesita constructor por
+    * defecto en el camino de error.
+    *
+    * Si `T` y `E` son trivialmente copiables, el almacenamiento también lo es y
+    * puede devolverse en registros (p. ej. `Resultado<int, CodigoParseo>`).
+    *
+    * No declara métodos virtuales (no agrega vptr); el destructor es protegido
+    * para impedir la destrucción polimórfica.
+    */
+    template<typename T, typename E>
     struct ResultadoBase{
+        template<typename, typename> friend struct ResultadoBase;
+
         protected:
-            err::Error error;
+            union {
+                T resultado;
+                E error;
+            };
+            bool ok;
+
+            template<typename... Args>
+            explicit ResultadoBase(std::in_place_t, Args&&... args)
+                noexcept(std::is_nothrow_constructible_v<T, Args...>)
+                : resultado(std::forward<Args>(args)...), ok(true) {};
+            explicit ResultadoBase(error_t, const E& e) noexcept(std::is_nothrow_copy_constructible_v<E>) : error(e), ok(false) {};
+            explicit ResultadoBase(error_t, E&& e) noexcept(std::is_nothrow_move_constructible_v<E>) : error(std::move(e)), ok(false) {};
+            // Construye el valor si `e` no es un error; en caso contrario, sólo el error.
+            ResultadoBase(T&& data, E&& e) noexcept(movimiento_seguro<T, E>);
+            // Conversión desde otra instanciación.
+            template<typename U, typename F>
+            explicit ResultadoBase(const ResultadoBase<U, F>& otro);
+            template<typename U, typename F>
+            explicit ResultadoBase(ResultadoBase<U, F>&& otro);
+
+            ~ResultadoBase() noexcept requires almacen_trivial<T, E> = default;
+            ~ResultadoBase() noexcept requires (!almacen_trivial<T, E>);
+
+            void destruir() noexcept;
+            // Reemplazan el contenido por un valor o por un error. `ok` cambia recién
+            // cuando el miembro nuevo quedó construido: si la copia lanza, la instancia
+            // conserva lo que tenía.
+            template<typename A>
+            void asignarValor(A&& fuente);
+            template<typename A>
+            void asignarError(A&& fuente);
+            // Deja la instancia en el estado `RasgosError<E>::movido()`. Si `E` no lo
+            // provee, un éxito queda con un valor inicializado a cero (cuando `T` lo
+            // admite) y un fallo conserva su error movido-desde: nunca pasa a éxito.
+            void marcarMovido() noexcept;
         public:
-            ResultadoBase() noexcept: error(err::EXITO) {};
-            virtual ~ResultadoBase() noexcept = default ;
+            ResultadoBase(const ResultadoBase&) requires almacen_trivial<T, E> = default;
+            ResultadoBase(const ResultadoBase& otro) requires (!almacen_trivial<T, E> && almacen_copiable<T, E>);
+            ResultadoBase(const ResultadoBase&) requires (!almacen_copiable<T, E>) = delete;
+            ResultadoBase(ResultadoBase&&) requires almacen_trivial<T, E> = default;
+            ResultadoBase(ResultadoBase&& otro) noexcept(movimiento_seguro<T, E>)
+                requires (!almacen_trivial<T, E>);
+
+            ResultadoBase& operator=(const ResultadoBase&) requires almacen_trivial<T, E> = default;
+            ResultadoBase& operator=(const ResultadoBase& otro) requires (!almacen_trivial<T, E> && almacen_copiable<T, E>);
+            ResultadoBase& operator=(const ResultadoBase&) requires (!almacen_copiable<T, E>) = delete;
+            ResultadoBase& operator=(ResultadoBase&&) requires almacen_trivial<T, E> = default;
+            ResultadoBase& operator=(ResultadoBase&& otro) noexcept(movimiento_seguro<T, E>)
+                requires (!almacen_trivial<T, E>);
+
+            // Referencia al error; si el resultado es exitoso, a una instancia
+            // compartida de `RasgosError<E>::exito()`. No copia el error.
+            const E& Error() const & noexcept {return ok ? exitoCompartido() : this->error;};
+            // Sobre un temporal, el error movido (o `RasgosError<E>::exito()` si es exitoso).
+            E Error() && noexcept {return ok ? RasgosError<E>::exito() : std::move(this->error);};
+            operator bool() const noexcept {return ok;};
 
-            err::Error Error() const noexcept {return this->error;};
-            operator bool() noexcept {return !error;};
+        private:
+            static const E& exitoCompartido() noexcept;
     };
-    
+
+    template<typename T, typename E = err::Error>
+    struct Resultado;
+
     /**
     * @brief Estructura que representa el resultado de una operación.
     *
@@ -39,20 +203,25 @@ namespace res { //Declaración
     * ya que podría resultar en un comportamiento indefinido (por ejemplo, doble
     * liberación de memoria).
     *
+    * @tparam E Tipo del error. Por defecto `err::Error`; puede ser un tipo liviano
+    * (p. ej. un `enum`) según `RasgosError<E>`, de modo que `Resultado<int, CodigoParseo>`
+    * quepa en un par de registros.
+    *
     * **Advertencia**: Los punteros (inteligentes o desnudos) deben ser únicos en propiedad. 
     * La llamada a `operator()` transfiere la propiedad del valor a la parte que llama, liberando
     * el recurso de la instancia original.
     *
+    * **Almacenamiento**: el valor y el error ocupan la misma memoria (ver
+    * `ResultadoBase`). Al construir con un error, el valor recibido se descarta;
+    * si es un puntero desnudo, se libera en ese momento, ya que no podría
+    * cederse mediante `Consumir`.
+    *
     * **Operadores**:
     * - `operator()`: Devuelve una tupla `std::tuple<T, bool>`, donde el segundo valor indica
     *   si el resultado es válido (`true`) o no (`false`).
     */
-    template<typename T>
-    struct Resultado : public ResultadoBase<T>{
-        private:
-            T resultado;
-            using ResultadoBase<T>::error;
-
+    template<typename T, typename E>
+    struct Resultado : public ResultadoBase<T, E>{
         public:
             explicit Resultado() noexcept
                 requires utiles::genericos::sin_constructor_por_defecto<T> = delete;
@@ -60,195 +229,647 @@ namespace res { //Declaración
                 requires utiles::genericos::con_constructor_por_defecto<T>;
 
             explicit Resultado(T data) noexcept;
-            explicit Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept;
-            explicit Resultado(T data, err::Error error) noexcept;
+            explicit Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept
+                requires std::constructible_from<E, err::Error>;
+            explicit Resultado(T data, E error) noexcept(movimiento_seguro<T, E>);
+            // Resultado fallido: no construye ningún `T`. El error se copia o se mueve una sola vez.
+            explicit Resultado(error_t, const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>);
+            explicit Resultado(error_t, E&& error) noexcept(std::is_nothrow_move_constructible_v<E>);
+            // Forma corta, sólo si `T` y `E` no pueden confundirse (ver `error_inequivoco`).
+            explicit Resultado(E error) noexcept requires error_inequivoco<T, E>
+                : Resultado(en_error, std::move(error)) {};
+            // Resultado exitoso con el valor construido en su lugar a partir de `args`.
+            template<typename... Args>
+            explicit Resultado(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+                : ResultadoBase<T, E>(std::in_place, std::forward<Args>(args)...) {};
+
+            // Conversión entre instanciaciones con valor y error convertibles.
+            template<typename U, typename F>
+                requires (!std::same_as<Resultado<U, F>, Resultado<T, E>>)
+                    && std::constructible_from<T, const U&> && std::constructible_from<E, const F&>
+            explicit(!std::convertible_to<const U&, T> || !std::convertible_to<const F&, E>)
+            Resultado(const Resultado<U, F>& otro) : ResultadoBase<T, E>(static_cast<const ResultadoBase<U, F>&>(otro)) {};
+            template<typename U, typename F>
+                requires (!std::same_as<Resultado<U, F>, Resultado<T, E>>)
+                    && std::constructible_from<T, U&&> && std::constructible_from<E, F&&>
+            explicit(!std::convertible_to<U&&, T> || !std::convertible_to<F&&, E>)
+            Resultado(Resultado<U, F>&& otro) : ResultadoBase<T, E>(static_cast<ResultadoBase<U, F>&&>(otro)) {};
+
+            Resultado(const Resultado<T, E>&) = default;
+            Resultado(Resultado<T, E>&&) noexcept(movimiento_seguro<T, E>) = default;
+            Resultado& operator=(const Resultado<T, E>&) = default;
+            Resultado& operator=(Resultado<T, E>&&) noexcept(movimiento_seguro<T, E>) = default;
             
-            ~Resultado() noexcept;
-
-            std::tuple<T, err::Error>Consumir(T porDefecto) noexcept
+            ~Resultado() noexcept = default;
+
+            /**
+            * @brief Reemplaza el contenido por un valor construido en su lugar.
+            *
+            * Destruye el miembro activo (valor o error) y construye `T` directamente
+            * en el almacenamiento a partir de `args`; el resultado pasa a ser exitoso.
+            *
+            * Si la construcción lanza, el resultado vuelve al error que tenía. Si
+            * tenía un valor, queda en `RasgosError<E>::movido()`. Si `E` no lo
+            * provee, recupera ese valor (cuando `T` se mueve sin lanzar), queda con
+            * un valor inicializado a cero (cuando `T` se construye así sin lanzar)
+            * o, en último caso, el valor nuevo se construye aparte y se asigna, y
+            * rige la garantía de la asignación de `T`. La excepción se propaga.
+            *
+            * @return Una referencia al valor construido.
+            */
+            template<typename... Args>
+            T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+
+            /**
+            * @brief Acceso al valor sin consumir el resultado.
+            *
+            * Ni copian el valor ni arman una tupla. `Valor()` exige un resultado
+            * exitoso (verificar antes con `operator bool`); sobre un temporal
+            * devuelve el valor movido. `si()` devuelve `nullptr` si hubo un error.
+            */
+            const T& Valor() const & noexcept { return this->resultado; };
+            T& Valor() & noexcept { return this->resultado; };
+            T Valor() && noexcept(std::is_nothrow_move_constructible_v<T>) { return std::move(this->resultado); };
+            const T* si() const noexcept { return this->ok ? &this->resultado : nullptr; };
+            T* si() noexcept { return this->ok ? &this->resultado : nullptr; };
+
+            /**
+            * @brief Combinadores: encadenan operaciones sin desempacar el resultado.
+            *
+            * - `mapear(f)`: `Resultado<U, E>` con `f(valor)`, o el mismo error.
+            * - `yLuego(f)`: `f(valor)`, que devuelve un `Resultado<U, E>`, o el mismo error.
+            * - `oSino(f)`: este valor si fue exitoso; si no, `f(error)`, que devuelve un `Resultado<T, F>`.
+            * - `transformarError(f)`: `Resultado<T, F>` con el mismo valor, o con `f(error)`.
+            *
+            * No arman tuplas ni copian el valor: `f` recibe una referencia (o el
+            * valor movido si el resultado es un temporal) y cada etapa devuelve su
+            * resultado por valor. Con un `E` trivial, una cadena de validaciones
+            * ocupa casi lo mismo que la cascada de `if` escrita a mano; con
+            * `err::Error` ocupa bastante más (ver `documentación/Pruebas.md`).
+            */
+            template<typename F> auto mapear(F&& f) const &;
+            template<typename F> auto mapear(F&& f) &&;
+            template<typename F> auto yLuego(F&& f) const &;
+            template<typename F> auto yLuego(F&& f) &&;
+            template<typename F> auto oSino(F&& f) const &;
+            template<typename F> auto oSino(F&& f) &&;
+            template<typename F> auto transformarError(F&& f) const &;
+            template<typename F> auto transformarError(F&& f) &&;
+
+            // Sobre un temporal (o tras `std::move`) el valor y el error se mueven
+            // a la tupla en lugar de copiarse; admite tipos sólo movibles.
+            std::tuple<T, E>Consumir(T porDefecto) & noexcept
                 requires utiles::genericos::sin_constructor_por_defecto<T>;
-            std::tuple<T, err::Error>Consumir() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+            std::tuple<T, E>Consumir(T porDefecto) && noexcept
+                requires utiles::genericos::sin_constructor_por_defecto<T>;
+            std::tuple<T, E>Consumir() & noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+                requires utiles::genericos::con_constructor_por_defecto<T>;
+            std::tuple<T, E>Consumir() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
                 requires utiles::genericos::con_constructor_por_defecto<T>;
 
-            operator bool() noexcept;
-            std::tuple<T, err::Error> operator()(T porDefecto) noexcept
+            /**
+            * @brief Mueve el valor (o el error) fuera del resultado.
+            *
+            * Equivale a `std::move(resultado).Consumir()`: no copia el valor y deja
+            * la instancia en estado movido (ver `RasgosError<E>::movido`), igual que
+            * las especializaciones para punteros.
+            */
+            std::tuple<T, E> Extraer() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+                requires utiles::genericos::con_constructor_por_defecto<T>;
+            std::tuple<T, E> Extraer(T porDefecto) noexcept
+                requires utiles::genericos::sin_constructor_por_defecto<T>;
+
+            std::tuple<T, E> operator()(T porDefecto) & noexcept
                 requires utiles::genericos::sin_constructor_por_defecto<T>;
-            std::tuple<T, err::Error> operator()() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+            std::tuple<T, E> operator()(T porDefecto) && noexcept
+                requires utiles::genericos::sin_constructor_por_defecto<T>;
+            std::tuple<T, E> operator()() & noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+                requires utiles::genericos::con_constructor_por_defecto<T>;
+            std::tuple<T, E> operator()() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
                 requires utiles::genericos::con_constructor_por_defecto<T>;
     };
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    struct Resultado<T> : public ResultadoBase<T>{
-        private:
-            T resultado;
-            using ResultadoBase<T>::error;
-
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    struct Resultado<T, E> : public ResultadoBase<T, E>{
         public:
             Resultado() noexcept;
 
             explicit Resultado(T data) noexcept;
             
-            Resultado(const Resultado<T>&) = delete;
-            Resultado operator=(const Resultado<T>&) = delete;
+            Resultado(const Resultado<T, E>&) = delete;
+            Resultado& operator=(const Resultado<T, E>&) = delete;
 
-            Resultado(const Resultado<T>&& otro) noexcept;
-            Resultado& operator=(const Resultado<T>&& otro) noexcept;
+            Resultado(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>);
+            Resultado& operator=(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>);
             
-            explicit Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept;
-            explicit Resultado(T data, err::Error error) noexcept;
-
-            std::tuple<T, err::Error>Consumir() noexcept;
+            explicit Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept
+                requires std::constructible_from<E, err::Error>;
+            explicit Resultado(T data, E error) noexcept(movimiento_seguro<T, E>);
+            explicit Resultado(error_t, const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>);
+            explicit Resultado(error_t, E&& error) noexcept(std::is_nothrow_move_constructible_v<E>);
+            explicit Resultado(E error) noexcept requires error_inequivoco<T, E>
+                : Resultado(en_error, std::move(error)) {};
+
+            // Puntero prestado al objeto apuntado, o `nullptr` si hubo un error. No cede la propiedad.
+            T si() const noexcept { return this->ok ? this->resultado : nullptr; };
+            std::tuple<T, E>Consumir() noexcept;
             ~Resultado() noexcept;
 
-            operator bool() noexcept;
-            std::tuple<T, err::Error> operator()() noexcept;
+            std::tuple<T, E> operator()() noexcept;
     };
 
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    struct Resultado<T> : public ResultadoBase<typename T::element_type>{
-        private:
-            T resultado;
-            using ResultadoBase<typename T::element_type>::error;
-
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    struct Resultado<T, E> : public ResultadoBase<T, E>{
         public:
-            Resultado() noexcept : resultado(nullptr), ResultadoBase<typename T::element_type>::error(err::Exito()) {};
+            Resultado() noexcept : ResultadoBase<T, E>(std::in_place, nullptr) {};
 
             explicit Resultado(T data) noexcept;
             
-            Resultado(const Resultado<T>&) = delete;
-            Resultado operator=(const Resultado<T>&) = delete;
+            Resultado(const Resultado<T, E>&) = delete;
+            Resultado& operator=(const Resultado<T, E>&) = delete;
 
-            Resultado(const Resultado<T>&& otro) noexcept;
-            Resultado& operator=(const Resultado<T>&& otro) noexcept;
+            Resultado(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>);
+            Resultado& operator=(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>);
             
-            explicit Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept;
-            explicit Resultado(T data, err::Error error) noexcept;
-
-            std::tuple<T, err::Error>Consumir() noexcept;
-            ~Resultado() noexcept {};
-
-            operator bool() noexcept;
-            std::tuple<T, err::Error> operator()() noexcept;
+            explicit Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept
+                requires std::constructible_from<E, err::Error>;
+            explicit Resultado(T data, E error) noexcept(movimiento_seguro<T, E>);
+            explicit Resultado(error_t, const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>);
+            explicit Resultado(error_t, E&& error) noexcept(std::is_nothrow_move_constructible_v<E>);
+            explicit Resultado(E error) noexcept requires error_inequivoco<T, E>
+                : Resultado(en_error, std::move(error)) {};
+
+            // Puntero prestado al objeto apuntado, o `nullptr` si hubo un error. No cede la propiedad.
+            typename T::element_type* si() const noexcept { return this->ok ? this->resultado.get() : nullptr; };
+            std::tuple<T, E>Consumir() noexcept;
+            ~Resultado() noexcept = default;
+
+            std::tuple<T, E> operator()() noexcept;
     };
 }
 
 namespace res { // Implementación
-    template <typename T>
-    Resultado<T>::Resultado() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
-    requires utiles::genericos::con_constructor_por_defecto<T> {
-        this->resultado = T{};
-        this->error = err::Exito();
+    /*
+     *  Almacenamiento
+     */
+
+    template<typename T, typename E>
+    ResultadoBase<T, E>::ResultadoBase(T&& data, E&& e) noexcept(movimiento_seguro<T, E>)
+        : ok(!RasgosError<E>::esError(e)) {
+        if (ok) {
+            std::construct_at(&this->resultado, std::move(data));
+        } else {
+            std::construct_at(&this->error, std::move(e));
+        }
+    }
+
+    template<typename T, typename E>
+    template<typename U, typename F>
+    ResultadoBase<T, E>::ResultadoBase(const ResultadoBase<U, F>& otro) : ok(otro.ok) {
+        if (ok) {
+            std::construct_at(&this->resultado, otro.resultado);
+        } else {
+            std::construct_at(&this->error, otro.error);
+        }
+    }
+
+    template<typename T, typename E>
+    template<typename U, typename F>
+    ResultadoBase<T, E>::ResultadoBase(ResultadoBase<U, F>&& otro) : ok(otro.ok) {
+        if (ok) {
+            std::construct_at(&this->resultado, std::move(otro.resultado));
+        } else {
+            std::construct_at(&this->error, std::move(otro.error));
+        }
+    }
+
+    template<typename T, typename E>
+    ResultadoBase<T, E>::ResultadoBase(const ResultadoBase& otro)
+        requires (!almacen_trivial<T, E> && almacen_copiable<T, E>)
+        : ok(otro.ok) {
+        if (ok) {
+            std::construct_at(&this->resultado, otro.resultado);
+        } else {
+            std::construct_at(&this->error, otro.error);
+        }
+    }
+
+    template<typename T, typename E>
+    ResultadoBase<T, E>::ResultadoBase(ResultadoBase&& otro) noexcept(movimiento_seguro<T, E>)
+        requires (!almacen_trivial<T, E>)
+        : ok(otro.ok) {
+        if (ok) {
+            std::construct_at(&this->resultado, std::move(otro.resultado));
+        } else {
+            std::construct_at(&this->error, std::move(otro.error));
+        }
+    }
+
+    template<typename T, typename E>
+    ResultadoBase<T, E>& ResultadoBase<T, E>::operator=(const ResultadoBase& otro)
+        requires (!almacen_trivial<T, E> && almacen_copiable<T, E>) {
+        if (this != &otro) {
+            if (otro.ok) {
+                asignarValor(otro.resultado);
+            } else {
+                asignarError(otro.error);
+            }
+        }
+        return *this;
+    }
+
+    template<typename T, typename E>
+    ResultadoBase<T, E>& ResultadoBase<T, E>::operator=(ResultadoBase&& otro) noexcept(movimiento_seguro<T, E>)
+        requires (!almacen_trivial<T, E>) {
+        if (this != &otro) {
+            if (otro.ok) {
+                asignarValor(std::move(otro.resultado));
+            } else {
+                asignarError(std::move(otro.error));
+            }
+        }
+        return *this;
+    }
+
+    template<typename T, typename E>
+    ResultadoBase<T, E>::~ResultadoBase() noexcept requires (!almacen_trivial<T, E>) {
+        destruir();
+    }
+
+    template<typename T, typename E>
+    void ResultadoBase<T, E>::destruir() noexcept {
+        if (ok) {
+            std::destroy_at(&this->resultado);
+        } else {
+            std::destroy_at(&this->error);
+        }
+    }
+
+    template<typename T, typename E>
+    template<typename A>
+    void ResultadoBase<T, E>::asignarValor(A&& fuente) {
+        if constexpr (std::is_nothrow_constructible_v<T, A>) {
+            destruir();
+            std::construct_at(&this->resultado, std::forward<A>(fuente));
+        } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            // La copia puede lanzar: se hace aparte, antes de tocar el contenido actual.
+            T nuevo(std::forward<A>(fuente));
+            destruir();
+            std::construct_at(&this->resultado, std::move(nuevo));
+        } else {
+            static_assert(std::is_assignable_v<T&, A>,
+                "Resultado: T sin construcción noexcept debe admitir asignación");
+            if (ok) {
+                // Sin construcción que no lance, rige la garantía de la asignación de `T`.
+                this->resultado = std::forward<A>(fuente);
+                return;
+            }
+            // Se aparta el error para restaurarlo si el valor no llega a construirse.
+            E previo(std::move(this->error));
+            std::destroy_at(&this->error);
+            try {
+                std::construct_at(&this->resultado, std::forward<A>(fuente));
+            } catch (...) {
+                std::construct_at(&this->error, std::move(previo));
+                throw;
+            }
+        }
+        this->ok = true;
+    }
+
+    template<typename T, typename E>
+    template<typename A>
+    void ResultadoBase<T, E>::asignarError(A&& fuente) {
+        if constexpr (std::is_nothrow_constructible_v<E, A>) {
+            destruir();
+            std::construct_at(&this->error, std::forward<A>(fuente));
+        } else {
+            static_assert(std::is_nothrow_move_constructible_v<E>,
+                "Resultado: el movimiento de E no debe lanzar");
+            E nuevo(std::forward<A>(fuente));
+            destruir();
+            std::construct_at(&this->error, std::move(nuevo));
+        }
+        this->ok = false;
+    }
+
+    template<typename T, typename E>
+    void ResultadoBase<T, E>::marcarMovido() noexcept {
+        if constexpr (requires { RasgosError<E>::movido(); }) {
+            destruir();
+            std::construct_at(&this->error, RasgosError<E>::movido());
+            this->ok = false;
+        } else if constexpr (utiles::genericos::con_constructor_por_defecto<T>) {
+            if (this->ok) {
+                std::destroy_at(&this->resultado);
+                std::construct_at(&this->resultado);
+            }
+        }
+        // En otro caso, el miembro activo queda en su estado movido-desde.
+    }
+
+    template<typename T, typename E>
+    const E& ResultadoBase<T, E>::exitoCompartido() noexcept {
+        static const E exito = RasgosError<E>::exito();
+        return exito;
     }
+
+    /*
+     *  Valores directos
+     */
+
+    template <typename T, typename E>
+    Resultado<T, E>::Resultado() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+    requires utiles::genericos::con_constructor_por_defecto<T> 
+        : ResultadoBase<T, E>(std::in_place) {}
     
-    template<typename T>
-    Resultado<T>::Resultado(T data) noexcept{
-        this->resultado = data;        
-        this->error = err::Exito();
+    template<typename T, typename E>
+    Resultado<T, E>::Resultado(T data) noexcept
+        : ResultadoBase<T, E>(std::in_place, std::move(data)) {}
+
+    template<typename T, typename E>
+    Resultado<T, E>::Resultado(T data, E e) noexcept(movimiento_seguro<T, E>)
+        : ResultadoBase<T, E>(std::move(data), std::move(e)) {}
+
+    template<typename T, typename E>
+    Resultado<T, E>::Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept
+        requires std::constructible_from<E, err::Error>
+        : ResultadoBase<T, E>(std::move(data), E(err::Error(codigo, std::move(mensaje)))) {}
+
+    template<typename T, typename E>
+    Resultado<T, E>::Resultado(error_t, const E& e) noexcept(std::is_nothrow_copy_constructible_v<E>)
+        : ResultadoBase<T, E>(en_error, e) {}
+
+    template<typename T, typename E>
+    Resultado<T, E>::Resultado(error_t, E&& e) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : ResultadoBase<T, E>(en_error, std::move(e)) {}
+
+    template<typename T, typename E>
+    template<typename... Args>
+    T& Resultado<T, E>::emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+            this->destruir();
+            std::construct_at(&this->resultado, std::forward<Args>(args)...);
+        } else if (!this->ok) {
+            E previo(std::move(this->error));
+            std::destroy_at(&this->error);
+            try {
+                std::construct_at(&this->resultado, std::forward<Args>(args)...);
+            } catch (...) {
+                std::construct_at(&this->error, std::move(previo));
+                throw;
+            }
+        } else if constexpr (requires { RasgosError<E>::movido(); }) {
+            this->destruir();
+            try {
+                std::construct_at(&this->resultado, std::forward<Args>(args)...);
+            } catch (...) {
+                std::construct_at(&this->error, RasgosError<E>::movido());
+                this->ok = false;
+                throw;
+            }
+        } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            // Sin estado movido, se aparta el valor anterior para restaurarlo.
+            T previo(std::move(this->resultado));
+            std::destroy_at(&this->resultado);
+            try {
+                std::construct_at(&this->resultado, std::forward<Args>(args)...);
+            } catch (...) {
+                std::construct_at(&this->resultado, std::move(previo));
+                throw;
+            }
+        } else if constexpr (std::is_nothrow_default_constructible_v<T>) {
+            // Como `marcarMovido`: sin estado movido, queda un valor inicializado a cero.
+            std::destroy_at(&this->resultado);
+            try {
+                std::construct_at(&this->resultado, std::forward<Args>(args)...);
+            } catch (...) {
+                std::construct_at(&this->resultado);
+                throw;
+            }
+        } else {
+            static_assert(std::is_move_assignable_v<T>,
+                "Resultado: sin RasgosError<E>::movido(), emplace requiere construcción o movimiento noexcept, "
+                "constructor por defecto noexcept o asignación por movimiento");
+            // El valor nuevo se arma aparte: si lanza, el anterior sigue construido.
+            T nuevo(std::forward<Args>(args)...);
+            this->resultado = std::move(nuevo);
+        }
+        this->ok = true;
+        return this->resultado;
+    }
+
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::mapear(F&& f) const & {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        if (!this->ok) {
+            return Resultado<U, E>(en_error, this->error);
+        }
+        return Resultado<U, E>(std::invoke(std::forward<F>(f), this->resultado));
+    }
+
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::mapear(F&& f) && {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, T&&>>;
+        if (!this->ok) {
+            return Resultado<U, E>(en_error, std::move(this->error));
+        }
+        return Resultado<U, E>(std::invoke(std::forward<F>(f), std::move(this->resultado)));
+    }
+
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::yLuego(F&& f) const & {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        if (!this->ok) {
+            return R(en_error, this->error);
+        }
+        return R(std::invoke(std::forward<F>(f), this->resultado));
+    }
+
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::yLuego(F&& f) && {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, T&&>>;
+        if (!this->ok) {
+            return R(en_error, std::move(this->error));
+        }
+        return R(std::invoke(std::forward<F>(f), std::move(this->resultado)));
+    }
+
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::oSino(F&& f) const & {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, const E&>>;
+        if (this->ok) {
+            return R(this->resultado);
+        }
+        return R(std::invoke(std::forward<F>(f), this->error));
     }
 
-    template<typename T>
-    Resultado<T>::Resultado(T data, err::Error e) noexcept{
-        this->resultado = data;
-        this->error = e;
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::oSino(F&& f) && {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, E&&>>;
+        if (this->ok) {
+            return R(std::move(this->resultado));
+        }
+        return R(std::invoke(std::forward<F>(f), std::move(this->error)));
     }
 
-    template<typename T>
-    Resultado<T>::Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept{
-        this->resultado = data;
-        err::Error e(codigo,mensaje);
-        this->error = e;
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::transformarError(F&& f) const & {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, const E&>>;
+        if (this->ok) {
+            return Resultado<T, G>(this->resultado);
+        }
+        return Resultado<T, G>(en_error, std::invoke(std::forward<F>(f), this->error));
     }
 
-    template<typename T>
-    Resultado<T>::~Resultado() noexcept{
-        if constexpr (std::is_pointer<T>::value) {
-            delete resultado; 
+    template<typename T, typename E>
+    template<typename F>
+    auto Resultado<T, E>::transformarError(F&& f) && {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, E&&>>;
+        if (this->ok) {
+            return Resultado<T, G>(std::move(this->resultado));
         }
+        return Resultado<T, G>(en_error, std::invoke(std::forward<F>(f), std::move(this->error)));
     }
 
-    template<typename T>
-    std::tuple<T, err::Error> Resultado<T>::Consumir(T porDefecto) noexcept
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::Consumir(T porDefecto) & noexcept
         requires utiles::genericos::sin_constructor_por_defecto<T> {
-        bool ok = !this->Error();
-        return std::make_tuple(ok ? this->resultado : porDefecto, error);
+        return std::make_tuple(this->ok ? this->resultado : porDefecto, this->Error());
     };
 
-    template<typename T>
-    std::tuple<T, err::Error> Resultado<T>::Consumir() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::Consumir(T porDefecto) && noexcept
+        requires utiles::genericos::sin_constructor_por_defecto<T> {
+        return Extraer(std::move(porDefecto));
+    };
+
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::Consumir() & noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        requires utiles::genericos::con_constructor_por_defecto<T> {
+        return std::make_tuple(this->ok ? this->resultado : T{}, this->Error());
+    }
+
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::Consumir() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
         requires utiles::genericos::con_constructor_por_defecto<T> {
-        bool ok = !this->Error();
-        return std::make_tuple(ok ? this->resultado : T{}, error);
+        return Extraer();
     }
 
-    template<typename T>
-    std::tuple<T, err::Error> Resultado<T>::operator()() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::Extraer() noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        requires utiles::genericos::con_constructor_por_defecto<T> {
+        std::tuple<T, E> salida(this->ok ? std::move(this->resultado) : T{},
+                                this->ok ? RasgosError<E>::exito() : std::move(this->error));
+        this->marcarMovido();
+        return salida;
+    }
+
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::Extraer(T porDefecto) noexcept
+        requires utiles::genericos::sin_constructor_por_defecto<T> {
+        std::tuple<T, E> salida(this->ok ? std::move(this->resultado) : std::move(porDefecto),
+                                this->ok ? RasgosError<E>::exito() : std::move(this->error));
+        this->marcarMovido();
+        return salida;
+    }
+
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::operator()() & noexcept(utiles::genericos::con_constructor_por_defecto<T>)
         requires utiles::genericos::con_constructor_por_defecto<T> {
             return Consumir();
         }
 
-    template<typename T>
-    std::tuple<T, err::Error> Resultado<T>::operator()(T porDefecto) noexcept
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::operator()() && noexcept(utiles::genericos::con_constructor_por_defecto<T>)
+        requires utiles::genericos::con_constructor_por_defecto<T> {
+            return Extraer();
+        }
+
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::operator()(T porDefecto) & noexcept
         requires utiles::genericos::sin_constructor_por_defecto<T> {
             return Consumir(porDefecto);
         }
 
+    template<typename T, typename E>
+    std::tuple<T, E> Resultado<T, E>::operator()(T porDefecto) && noexcept
+        requires utiles::genericos::sin_constructor_por_defecto<T> {
+            return Extraer(std::move(porDefecto));
+        }
+
     /*
      *  Especialización para Punteros Desnudos
      */
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>::Resultado() noexcept{
-        this->resultado = nullptr;
-        this->error = err::Exito();
-    }
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado() noexcept
+        : ResultadoBase<T, E>(std::in_place, nullptr) {}
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>::Resultado(const Resultado<T>&& otro) noexcept{
-        this->resultado = std::exchange(otro->resultado, nullptr);
-        this->error = std::exchange(otro.error, err::Generico("Resultado movido."));
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>)
+        : ResultadoBase<T, E>(std::move(otro)) {
+        otro.marcarMovido();
     }
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>& Resultado<T>::operator=(const Resultado<T>&& otro) noexcept{
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>& Resultado<T, E>::operator=(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>) {
         if (this != &otro){
-            this->resultado = std::exchange(otro->resultado, nullptr);
-            this->error = std::exchange(otro.error, err::Generico("Resultado movido."));
+            if (this->ok) {
+                delete this->resultado;
+            }
+            ResultadoBase<T, E>::operator=(std::move(otro));
+            otro.marcarMovido();
         }
         return *this;
     }
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>::Resultado(T data) noexcept{
-        this->resultado = data;        
-        this->error = err::Exito();
-    }
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado(T data) noexcept
+        : ResultadoBase<T, E>(std::in_place, data) {}
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>::Resultado(T data, err::Error e) noexcept{
-        this->resultado = data;
-        this->error = e;
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado(T data, E e) noexcept(movimiento_seguro<T, E>)
+        : ResultadoBase<T, E>(T{data}, std::move(e)) {
+        if (!this->ok) {
+            delete data;
+        }
     }
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>::Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept{
-        this->resultado = data;
-        err::Error e(codigo,mensaje);
-        this->error = e;
-    }
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept
+        requires std::constructible_from<E, err::Error>
+        : Resultado<T, E>(data, E(err::Error(codigo, std::move(mensaje)))) {}
+
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado(error_t, const E& e) noexcept(std::is_nothrow_copy_constructible_v<E>)
+        : ResultadoBase<T, E>(en_error, e) {}
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    Resultado<T>::~Resultado() noexcept{
-        delete resultado; 
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::Resultado(error_t, E&& e) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : ResultadoBase<T, E>(en_error, std::move(e)) {}
+
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    Resultado<T, E>::~Resultado() noexcept{
+        if (this->ok) {
+            delete this->resultado;
+        }
     }
 
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    std::tuple<T, err::Error> Resultado<T>::Consumir() noexcept{
-        bool ok = !this->Error();
-        return std::make_tuple(ok ? std::exchange(this->resultado,nullptr) : nullptr, error);
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    std::tuple<T, E> Resultado<T, E>::Consumir() noexcept{
+        return std::make_tuple(this->ok ? std::exchange(this->resultado,nullptr) : nullptr, this->Error());
 
     }
-    template <typename T> requires utiles::genericos::puntero_desnudo<T>
-    std::tuple<T, err::Error> Resultado<T>::operator()() noexcept{
+    template <typename T, typename E> requires utiles::genericos::puntero_desnudo<T>
+    std::tuple<T, E> Resultado<T, E>::operator()() noexcept{
         return Consumir();
     }
 
@@ -257,48 +878,53 @@ namespace res { // Implementación
      *  Especialización para Punteros Inteligentes
      */
 
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Resultado<T>::Resultado(T data) noexcept{
-        this->resultado = std::move(data);
-        this->error = err::Exito();
-    }
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>::Resultado(T data) noexcept
+        : ResultadoBase<T, E>(std::in_place, std::move(data)) {}
 
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Resultado<T>::Resultado(T data, err::Error e) noexcept{
-        this->resultado = std::move(data);
-        this->error = e;
-    }
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Resultado<T>::Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept{
-        this->resultado = std::move(data);
-        err::Error e(codigo,mensaje);
-        this->error = e;
-    }
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Resultado<T>::Resultado(const Resultado<T>&& otro) noexcept{
-        this->resultado = std::move(std::exchange(otro->resultado, nullptr));
-        this->error = std::exchange(otro.error, err::Generico("Resultado movido."));
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>::Resultado(T data, E e) noexcept(movimiento_seguro<T, E>)
+        : ResultadoBase<T, E>(std::move(data), std::move(e)) {}
+
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>::Resultado(T data, err::CodigoEstado codigo, std::string mensaje) noexcept
+        requires std::constructible_from<E, err::Error>
+        : ResultadoBase<T, E>(std::move(data), E(err::Error(codigo, std::move(mensaje)))) {}
+
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>::Resultado(error_t, const E& e) noexcept(std::is_nothrow_copy_constructible_v<E>)
+        : ResultadoBase<T, E>(en_error, e) {}
+
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>::Resultado(error_t, E&& e) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : ResultadoBase<T, E>(en_error, std::move(e)) {}
+
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>::Resultado(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>)
+        : ResultadoBase<T, E>(std::move(otro)) {
+        otro.marcarMovido();
     }
 
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    Resultado<T>& Resultado<T>::operator=(const Resultado<T>&& otro) noexcept{
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    Resultado<T, E>& Resultado<T, E>::operator=(Resultado<T, E>&& otro) noexcept(movimiento_seguro<T, E>) {
         if (this != &otro){
-            this->resultado = std::move(std::exchange(otro->resultado, nullptr));
-            this->error = std::exchange(otro.error, err::Generico("Resultado movido."));
+            ResultadoBase<T, E>::operator=(std::move(otro));
+            otro.marcarMovido();
         }
         return *this;
     }
 
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    std::tuple<T, err::Error> Resultado<T>::Consumir() noexcept{
-        bool ok = !this->Error();
-        return std::make_tuple(ok ? std::move(this->resultado) : nullptr, std::exchange(error,err::Generico("Resultado movido.")));
-       
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    std::tuple<T, E> Resultado<T, E>::Consumir() noexcept{
+        T valor = this->ok ? std::move(this->resultado) : nullptr;
+        E e = this->Error();
+        this->marcarMovido();
+        return std::make_tuple(std::move(valor), std::move(e));
     }
-    template <typename T> requires utiles::genericos::puntero_inteligente<T>
-    std::tuple<T, err::Error> Resultado<T>::operator()() noexcept{
+    template <typename T, typename E> requires utiles::genericos::puntero_inteligente<T>
+    std::tuple<T, E> Resultado<T, E>::operator()() noexcept{
         return Consumir();
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,489 @@
+#ifndef RESULTADO_ASYNC_HPP
+#define RESULTADO_ASYNC_HPP
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptos.hpp>
+#include "Error.hpp"
+#include "Resultado.hpp"
+
+namespace res { // Declaración
+    // Tipos de error que pueden completar un `ResultadoAsync` cancelado o abandonado.
+    template<typename E>
+    concept error_asincrono = requires {
+        { RasgosError<E>::cancelado() } -> std::convertible_to<E>;
+        { RasgosError<E>::abandonado() } -> std::convertible_to<E>;
+    };
+
+    /**
+    * @brief Tarea sin argumentos, sólo movible, que recibe un ejecutor.
+    *
+    * A diferencia de `std::function`, admite funciones que capturan tipos sólo
+    * movibles (promesas, `Resultado` con punteros, etc.).
+    */
+    class Tarea {
+        public:
+        template<typename F>
+            requires (!std::same_as<std::remove_cvref_t<F>, Tarea>) && std::invocable<std::remove_cvref_t<F>&>
+        Tarea(F&& f) : impl(std::make_unique<Modelo<std::remove_cvref_t<F>>>(std::forward<F>(f))) {};
+
+        Tarea(Tarea&&) noexcept = default;
+        Tarea& operator=(Tarea&&) noexcept = default;
+
+        void operator()() { impl->ejecutar(); };
+
+        private:
+        struct Base {
+            virtual void ejecutar() = 0;
+            virtual ~Base() = default;
+        };
+        template<typename F>
+        struct Modelo final : Base {
+            F f;
+            explicit Modelo(F f) : f(std::move(f)) {};
+            void ejecutar() override { std::invoke(f); };
+        };
+        std::unique_ptr<Base> impl;
+    };
+
+    // Cualquier tipo que acepte una `Tarea` mediante `ejecutar` (un hilo, un grupo de hilos, un bucle de eventos...).
+    template<typename X>
+    concept ejecutor = requires(X& x, Tarea tarea) { x.ejecutar(std::move(tarea)); };
+
+    // Ejecuta la tarea en el mismo hilo, en el momento.
+    struct EjecutorEnLinea {
+        void ejecutar(Tarea tarea) { tarea(); };
+    };
+
+    template<typename T, typename E = err::Error> requires error_asincrono<E>
+    class ResultadoAsync;
+    template<typename T, typename E = err::Error> requires error_asincrono<E>
+    class PromesaAsync;
+
+    // Parte del estado que no depende de `T`: una etapa de `luego` cancela a la anterior a través de ella.
+    class EstadoCancelable {
+        public:
+        virtual void cancelar() noexcept = 0;
+
+        protected:
+        ~EstadoCancelable() = default;
+    };
+
+    /**
+    * @brief Estado compartido entre una `PromesaAsync` y su `ResultadoAsync`.
+    *
+    * Se completa una única vez y admite una única continuación. El traspaso entre
+    * el hilo que completa y el que agrega la continuación usa sólo operaciones
+    * atómicas sobre `fase`: quien llega segundo ejecuta la continuación. Esperar
+    * el resultado bloquea con `std::atomic::wait`, sin mutex.
+    *
+    * La etapa creada por `luego` guarda una referencia débil a la anterior, de
+    * modo que cancelar el final de una cadena cancela también su origen.
+    */
+    template<typename T, typename E>
+    class EstadoAsync final : public EstadoCancelable {
+        public:
+        struct Continuacion {
+            virtual void ejecutar(Resultado<T, E>&& resultado) = 0;
+            virtual ~Continuacion() = default;
+        };
+
+        // Devuelve `false` si el estado ya estaba completo; el resultado se descarta.
+        bool completar(Resultado<T, E>&& resultado);
+        void alCompletar(std::unique_ptr<Continuacion> continuacion);
+        Resultado<T, E> esperar();
+        bool listo() const noexcept;
+
+        void cancelar() noexcept override;
+        bool cancelado() const noexcept;
+        // Etapa de la que depende esta; se fija antes de entregar el `ResultadoAsync`.
+        void encadenar(std::weak_ptr<EstadoCancelable> previa) noexcept { anterior = std::move(previa); };
+
+        private:
+        enum : std::uint8_t { RECLAMADO = 1, LISTO = 2, CONTINUADO = 4 };
+
+        std::atomic<std::uint8_t> fase{0};
+        std::atomic<bool> cancelacion{false};
+        std::optional<Resultado<T, E>> resultado;
+        std::unique_ptr<Continuacion> continuacion;
+        std::weak_ptr<EstadoCancelable> anterior;
+    };
+
+    /**
+    * @brief Resultado de una operación asíncrona: un `Resultado<T, E>` que estará disponible más adelante.
+    *
+    * Se obtiene de una `PromesaAsync<T, E>`, que lo completa desde cualquier hilo
+    * con un valor o con un error. Es sólo movible y se consume una vez, con
+    * `esperar()`, `luego(...)` o `alTerminar(...)`.
+    *
+    * - `luego(f)`: cuando hay valor, `f(T&&)` produce la etapa siguiente, que
+    *   puede devolver `U`, `Resultado<U, E>` o `ResultadoAsync<U, E>`; un error
+    *   saltea `f` y pasa directo a la etapa siguiente. Devuelve `ResultadoAsync<U, E>`.
+    * - `luego(f, ejecutor)`: igual, pero `f` corre en `ejecutor`.
+    * - `alTerminar(f)`: `f(Resultado<T, E>&&)` con el valor o el error.
+    * - `cancelar()`: completa la operación con `RasgosError<E>::cancelado()`; el
+    *   productor puede consultarlo con `PromesaAsync::cancelada()` y las etapas
+    *   posteriores a una cancelada no se ejecutan. Sobre la última etapa de una
+    *   cadena de `luego`, cancela también las anteriores hasta el productor.
+    *
+    * Un `ResultadoAsync` movido o consumido no está `listo()` y cancelarlo no
+    * tiene efecto.
+    *
+    * Las continuaciones corren en línea en el hilo que llega segundo: el que
+    * completa la promesa, o el que agrega la continuación si ya estaba completa.
+    */
+    template<typename T, typename E> requires error_asincrono<E>
+    class ResultadoAsync {
+        public:
+        // Resultado ya disponible.
+        explicit ResultadoAsync(Resultado<T, E> resultado);
+
+        ResultadoAsync(ResultadoAsync&&) noexcept = default;
+        ResultadoAsync& operator=(ResultadoAsync&&) noexcept = default;
+        ResultadoAsync(const ResultadoAsync&) = delete;
+        ResultadoAsync& operator=(const ResultadoAsync&) = delete;
+
+        bool listo() const noexcept;
+        // Bloquea hasta que la operación se complete.
+        Resultado<T, E> esperar() &&;
+
+        template<typename F>
+        auto luego(F&& f) &&;
+        template<typename F, ejecutor X>
+        auto luego(F&& f, X& ejecutor) &&;
+
+        template<typename F>
+            requires std::invocable<F&, Resultado<T, E>&&>
+        void alTerminar(F&& f) &&;
+
+        void cancelar() noexcept;
+
+        private:
+        friend class PromesaAsync<T, E>;
+        explicit ResultadoAsync(std::shared_ptr<EstadoAsync<T, E>> estado) noexcept : estado(std::move(estado)) {};
+
+        std::shared_ptr<EstadoAsync<T, E>> estado;
+    };
+
+    /**
+    * @brief Extremo productor de un `ResultadoAsync<T, E>`.
+    *
+    * Sólo movible; puede completarse desde cualquier hilo. Sólo cuenta la primera
+    * compleción (o cancelación). Si se destruye sin completarse, el resultado se
+    * completa con `RasgosError<E>::abandonado()`.
+    */
+    template<typename T, typename E> requires error_asincrono<E>
+    class PromesaAsync {
+        public:
+        PromesaAsync() : estado(std::make_shared<EstadoAsync<T, E>>()) {};
+        PromesaAsync(PromesaAsync&&) noexcept = default;
+        PromesaAsync& operator=(PromesaAsync&& otra) noexcept;
+        PromesaAsync(const PromesaAsync&) = delete;
+        PromesaAsync& operator=(const PromesaAsync&) = delete;
+        ~PromesaAsync();
+
+        // Debe llamarse una sola vez.
+        ResultadoAsync<T, E> obtenerResultado() { return ResultadoAsync<T, E>(estado); };
+
+        bool completar(Resultado<T, E> resultado) { return estado->completar(std::move(resultado)); };
+        bool cumplir(T valor) { return completar(Resultado<T, E>(std::move(valor))); };
+        bool fallar(E error) { return completar(Resultado<T, E>(en_error, std::move(error))); };
+        bool cancelada() const noexcept { return estado->cancelado(); };
+
+        private:
+        template<typename U, typename F> requires error_asincrono<F>
+        friend class ResultadoAsync;
+
+        std::shared_ptr<EstadoAsync<T, E>> estado;
+    };
+
+    // Todos los valores, en orden; o el primer error.
+    template<typename T, typename E>
+    ResultadoAsync<std::vector<T>, E> cuandoTodos(std::vector<ResultadoAsync<T, E>> resultados);
+
+    // El primero en completarse, con valor o con error.
+    template<typename T, typename E>
+    ResultadoAsync<T, E> cuandoCualquiera(std::vector<ResultadoAsync<T, E>> resultados);
+}
+
+namespace res { // Implementación
+    namespace detalle {
+        // Mueve el valor fuera de un resultado exitoso; los punteros ceden la propiedad.
+        template<typename T, typename E>
+        T extraerValor(Resultado<T, E>& resultado) {
+            if constexpr (requires { resultado.Valor(); }) {
+                return std::move(resultado).Valor();
+            } else {
+                return std::get<0>(resultado.Consumir());
+            }
+        }
+
+        // El error de la etapa de la que escapó una excepción: `RasgosError<E>::fatal` con su
+        // mensaje si `E` lo provee; si no, `abandonado()`.
+        template<typename E>
+        E errorDeExcepcion(std::string_view mensaje) {
+            if constexpr (requires { { RasgosError<E>::fatal(mensaje) } -> std::convertible_to<E>; }) {
+                return E(RasgosError<E>::fatal(mensaje));
+            } else {
+                return E(RasgosError<E>::abandonado());
+            }
+        }
+
+        // Cómo completa la promesa de la etapa siguiente el valor devuelto por la función de `luego`.
+        template<typename X, typename E>
+        struct EtapaAsync {
+            using Valor = X;
+            static void completar(PromesaAsync<X, E>& promesa, X&& valor) { promesa.cumplir(std::move(valor)); };
+        };
+        template<typename U, typename E>
+        struct EtapaAsync<Resultado<U, E>, E> {
+            using Valor = U;
+            static void completar(PromesaAsync<U, E>& promesa, Resultado<U, E>&& resultado) { promesa.completar(std::move(resultado)); };
+        };
+        template<typename U, typename E>
+        struct EtapaAsync<ResultadoAsync<U, E>, E> {
+            using Valor = U;
+            static void completar(PromesaAsync<U, E>& promesa, ResultadoAsync<U, E>&& interno) {
+                std::move(interno).alTerminar([promesa = std::move(promesa)](Resultado<U, E>&& resultado) mutable {
+                    promesa.completar(std::move(resultado));
+                });
+            };
+        };
+
+        template<typename T, typename E, typename F>
+        struct ContinuacionDe final : EstadoAsync<T, E>::Continuacion {
+            F f;
+            explicit ContinuacionDe(F f) : f(std::move(f)) {};
+            void ejecutar(Resultado<T, E>&& resultado) override { std::invoke(f, std::move(resultado)); };
+        };
+    }
+
+    /*
+     *  Estado compartido
+     */
+
+    template<typename T, typename E>
+    bool EstadoAsync<T, E>::completar(Resultado<T, E>&& r) {
+        if (fase.fetch_or(RECLAMADO, std::memory_order_acquire) & RECLAMADO) {
+            return false;
+        }
+        resultado.emplace(std::move(r));
+        if (fase.fetch_or(LISTO, std::memory_order_acq_rel) & CONTINUADO) {
+            continuacion->ejecutar(std::move(*resultado));
+            continuacion.reset();
+        } else {
+            fase.notify_all();
+        }
+        return true;
+    }
+
+    template<typename T, typename E>
+    void EstadoAsync<T, E>::alCompletar(std::unique_ptr<Continuacion> c) {
+        continuacion = std::move(c);
+        if (fase.fetch_or(CONTINUADO, std::memory_order_acq_rel) & LISTO) {
+            continuacion->ejecutar(std::move(*resultado));
+            continuacion.reset();
+        }
+    }
+
+    template<typename T, typename E>
+    Resultado<T, E> EstadoAsync<T, E>::esperar() {
+        std::uint8_t actual = fase.load(std::memory_order_acquire);
+        while (!(actual & LISTO)) {
+            fase.wait(actual, std::memory_order_acquire);
+            actual = fase.load(std::memory_order_acquire);
+        }
+        return std::move(*resultado);
+    }
+
+    template<typename T, typename E>
+    bool EstadoAsync<T, E>::listo() const noexcept {
+        return fase.load(std::memory_order_acquire) & LISTO;
+    }
+
+    template<typename T, typename E>
+    void EstadoAsync<T, E>::cancelar() noexcept {
+        cancelacion.store(true, std::memory_order_release);
+        completar(Resultado<T, E>(en_error, E(RasgosError<E>::cancelado())));
+        if (auto previa = anterior.lock()) {
+            previa->cancelar();
+        }
+    }
+
+    template<typename T, typename E>
+    bool EstadoAsync<T, E>::cancelado() const noexcept {
+        return cancelacion.load(std::memory_order_acquire);
+    }
+
+    /*
+     *  ResultadoAsync
+     */
+
+    template<typename T, typename E> requires error_asincrono<E>
+    ResultadoAsync<T, E>::ResultadoAsync(Resultado<T, E> resultado)
+        : estado(std::make_shared<EstadoAsync<T, E>>()) {
+        estado->completar(std::move(resultado));
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    bool ResultadoAsync<T, E>::listo() const noexcept {
+        return estado && estado->listo();
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    Resultado<T, E> ResultadoAsync<T, E>::esperar() && {
+        auto propio = std::move(estado);
+        return propio->esperar();
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    template<typename F>
+        requires std::invocable<F&, Resultado<T, E>&&>
+    void ResultadoAsync<T, E>::alTerminar(F&& f) && {
+        using Continuacion = detalle::ContinuacionDe<T, E, std::remove_cvref_t<F>>;
+        auto propio = std::move(estado);
+        propio->alCompletar(std::make_unique<Continuacion>(std::forward<F>(f)));
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    template<typename F>
+    auto ResultadoAsync<T, E>::luego(F&& f) && {
+        EjecutorEnLinea enLinea;
+        return std::move(*this).luego(std::forward<F>(f), enLinea);
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    template<typename F, ejecutor X>
+    auto ResultadoAsync<T, E>::luego(F&& f, X& ejecutor) && {
+        using Etapa = detalle::EtapaAsync<std::remove_cvref_t<std::invoke_result_t<F&, T&&>>, E>;
+        using U = typename Etapa::Valor;
+
+        PromesaAsync<U, E> siguiente;
+        siguiente.estado->encadenar(estado);
+        auto resultado = siguiente.obtenerResultado();
+        auto etapa = [f = std::forward<F>(f), siguiente = std::move(siguiente)](Resultado<T, E>&& r) mutable {
+            if (siguiente.cancelada()) {
+                return;
+            }
+            if (!r) {
+                siguiente.fallar(r.Error());
+                return;
+            }
+            // `f` corre en el hilo que completa la etapa anterior, a veces dentro de `cancelar()`
+            // o de un destructor: lo que lance no sale de acá. Si `Etapa::completar` ya cedió
+            // la promesa, quien la tiene ahora la completa al destruirse.
+            try {
+                Etapa::completar(siguiente, std::invoke(f, detalle::extraerValor(r)));
+            } catch (const std::exception& e) {
+                if (siguiente.estado) siguiente.fallar(detalle::errorDeExcepcion<E>(e.what()));
+            } catch (...) {
+                if (siguiente.estado) siguiente.fallar(detalle::errorDeExcepcion<E>({}));
+            }
+        };
+
+        if constexpr (std::same_as<X, EjecutorEnLinea>) {
+            std::move(*this).alTerminar(std::move(etapa));
+        } else {
+            std::move(*this).alTerminar([etapa = std::move(etapa), &ejecutor](Resultado<T, E>&& r) mutable {
+                ejecutor.ejecutar(Tarea([etapa = std::move(etapa), r = std::move(r)]() mutable {
+                    etapa(std::move(r));
+                }));
+            });
+        }
+        return resultado;
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    void ResultadoAsync<T, E>::cancelar() noexcept {
+        if (estado) {
+            estado->cancelar();
+        }
+    }
+
+    /*
+     *  PromesaAsync
+     */
+
+    template<typename T, typename E> requires error_asincrono<E>
+    PromesaAsync<T, E>& PromesaAsync<T, E>::operator=(PromesaAsync&& otra) noexcept {
+        if (this != &otra) {
+            if (estado) {
+                estado->completar(Resultado<T, E>(en_error, E(RasgosError<E>::abandonado())));
+            }
+            estado = std::move(otra.estado);
+        }
+        return *this;
+    }
+
+    template<typename T, typename E> requires error_asincrono<E>
+    PromesaAsync<T, E>::~PromesaAsync() {
+        if (estado) {
+            estado->completar(Resultado<T, E>(en_error, E(RasgosError<E>::abandonado())));
+        }
+    }
+
+    /*
+     *  Combinadores
+     */
+
+    template<typename T, typename E>
+    ResultadoAsync<std::vector<T>, E> cuandoTodos(std::vector<ResultadoAsync<T, E>> resultados) {
+        struct Agregado {
+            PromesaAsync<std::vector<T>, E> promesa;
+            std::vector<std::optional<T>> valores;
+            std::atomic<std::size_t> pendientes;
+            explicit Agregado(std::size_t n) : valores(n), pendientes(n) {};
+        };
+
+        auto agregado = std::make_shared<Agregado>(resultados.size());
+        auto total = agregado->promesa.obtenerResultado();
+        if (resultados.empty()) {
+            agregado->promesa.cumplir(std::vector<T>{});
+            return total;
+        }
+        for (std::size_t i = 0; i < resultados.size(); ++i) {
+            std::move(resultados[i]).alTerminar([agregado, i](Resultado<T, E>&& r) {
+                if (!r) {
+                    agregado->promesa.fallar(r.Error());
+                    return;
+                }
+                agregado->valores[i].emplace(detalle::extraerValor(r));
+                if (agregado->pendientes.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::vector<T> valores;
+                    valores.reserve(agregado->valores.size());
+                    for (auto& valor : agregado->valores) {
+                        valores.push_back(std::move(*valor));
+                    }
+                    agregado->promesa.cumplir(std::move(valores));
+                }
+            });
+        }
+        return total;
+    }
+
+    template<typename T, typename E>
+    ResultadoAsync<T, E> cuandoCualquiera(std::vector<ResultadoAsync<T, E>> resultados) {
+        auto promesa = std::make_shared<PromesaAsync<T, E>>();
+        auto primero = promesa->obtenerResultado();
+        for (auto& resultado : resultados) {
+            std::move(resultado).alTerminar([promesa](Resultado<T, E>&& r) {
+                promesa->completar(std::move(r));
+            });
+        }
+        // Sin entradas, la promesa se abandona al salir.
+        return primero;
+    }
+}
+#endif
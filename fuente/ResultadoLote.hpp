@@ -0,0 +1,203 @@
+#ifndef RESULTADO_LOTE_HPP
+#define RESULTADO_LOTE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <conceptos.hpp>
+#include "Error.hpp"
+#include "Resultado.hpp"
+#include "OpcionLote.hpp"
+
+namespace res { // Declaración
+    /**
+    * @brief Lote columnar de resultados: valores contiguos, un mapa de éxitos y
+    * una tabla aparte para los errores.
+    *
+    * Equivale a un `std::vector<Resultado<T, E>>` pensado para validaciones
+    * masivas, donde los errores son raros. Cada éxito ocupa `sizeof(T)` más un
+    * bit; cada error, además, una entrada `(índice, E)` en la tabla de errores,
+    * ordenada por índice. Las posiciones con error guardan `T{}`.
+    *
+    * Se llena sólo agregando al final (`agregar`, `agregarError`, `anexar`), lo
+    * que mantiene la tabla de errores ordenada sin costo. Varios productores
+    * pueden llenar lotes propios y luego anexarlos en orden.
+    */
+    template<typename T, typename E = err::Error> requires opc::valor_en_lote<T>
+    class ResultadoLote {
+        public:
+        ResultadoLote() = default;
+        explicit ResultadoLote(const std::vector<Resultado<T, E>>& resultados);
+        explicit ResultadoLote(std::vector<Resultado<T, E>>&& resultados);
+
+        std::size_t tamano() const noexcept { return valores.size(); };
+        void reservar(std::size_t tamano);
+
+        void agregar(T valor);
+        void agregarError(E error);
+        void agregar(const Resultado<T, E>& resultado);
+        void agregar(Resultado<T, E>&& resultado);
+        // Agrega al final todos los elementos de `otro`, en orden.
+        void anexar(ResultadoLote&& otro);
+
+        bool exito(std::size_t i) const noexcept { return exitos.leer(i); };
+        // El error del elemento `i`, o `nullptr` si fue exitoso. Búsqueda binaria en la tabla.
+        const E* error(std::size_t i) const noexcept;
+        // El elemento `i`, como resultado.
+        Resultado<T, E> operator[](std::size_t i) const;
+
+        std::size_t contarExitos() const noexcept { return valores.size() - fallos.size(); };
+        std::size_t contarErrores() const noexcept { return fallos.size(); };
+        // Llama a `f(i, error)` para cada fallo, en orden, sin recorrer los éxitos.
+        template<typename F>
+        void paraCadaFallo(F&& f) const;
+        // Llama a `f(i, valor)` para cada éxito, en orden.
+        template<typename F>
+        void paraCadaExito(F&& f) const;
+
+        std::vector<Resultado<T, E>> aResultados() const &;
+        std::vector<Resultado<T, E>> aResultados() &&;
+
+        // Acceso directo a las columnas, para operar sobre ellas en bloque.
+        const std::vector<T>& datos() const noexcept { return valores; };
+        const opc::MapaBits& mapa() const noexcept { return exitos; };
+        const std::vector<std::pair<std::size_t, E>>& errores() const noexcept { return fallos; };
+
+        private:
+        std::vector<T> valores;
+        opc::MapaBits exitos;
+        std::vector<std::pair<std::size_t, E>> fallos;
+    };
+}
+
+namespace res { // Implementación
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    ResultadoLote<T, E>::ResultadoLote(const std::vector<Resultado<T, E>>& resultados) {
+        reservar(resultados.size());
+        for (const auto& resultado : resultados) {
+            agregar(resultado);
+        }
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    ResultadoLote<T, E>::ResultadoLote(std::vector<Resultado<T, E>>&& resultados) {
+        reservar(resultados.size());
+        for (auto& resultado : resultados) {
+            agregar(std::move(resultado));
+        }
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    void ResultadoLote<T, E>::reservar(std::size_t tamano) {
+        valores.reserve(tamano);
+        exitos.reservar(tamano);
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    void ResultadoLote<T, E>::agregar(T valor) {
+        valores.push_back(std::move(valor));
+        exitos.agregar(true);
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    void ResultadoLote<T, E>::agregarError(E error) {
+        fallos.emplace_back(valores.size(), std::move(error));
+        valores.emplace_back();
+        exitos.agregar(false);
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    void ResultadoLote<T, E>::agregar(const Resultado<T, E>& resultado) {
+        if (resultado) {
+            agregar(resultado.Valor());
+        } else {
+            agregarError(resultado.Error());
+        }
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    void ResultadoLote<T, E>::agregar(Resultado<T, E>&& resultado) {
+        if (resultado) {
+            agregar(std::move(resultado).Valor());
+        } else {
+            agregarError(resultado.Error());
+        }
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    void ResultadoLote<T, E>::anexar(ResultadoLote&& otro) {
+        std::size_t desplazamiento = valores.size();
+        valores.insert(valores.end(), std::make_move_iterator(otro.valores.begin()), std::make_move_iterator(otro.valores.end()));
+        exitos.anexar(otro.exitos);
+        fallos.reserve(fallos.size() + otro.fallos.size());
+        for (auto& [indice, error] : otro.fallos) {
+            fallos.emplace_back(indice + desplazamiento, std::move(error));
+        }
+        otro = ResultadoLote();
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    const E* ResultadoLote<T, E>::error(std::size_t i) const noexcept {
+        auto it = std::lower_bound(fallos.begin(), fallos.end(), i,
+            [](const std::pair<std::size_t, E>& fallo, std::size_t indice) { return fallo.first < indice; });
+        return (it != fallos.end() && it->first == i) ? &it->second : nullptr;
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    Resultado<T, E> ResultadoLote<T, E>::operator[](std::size_t i) const {
+        if (exito(i)) {
+            return Resultado<T, E>(valores[i]);
+        }
+        return Resultado<T, E>(en_error, *error(i));
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    template<typename F>
+    void ResultadoLote<T, E>::paraCadaFallo(F&& f) const {
+        for (const auto& [indice, error] : fallos) {
+            f(indice, error);
+        }
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    template<typename F>
+    void ResultadoLote<T, E>::paraCadaExito(F&& f) const {
+        exitos.paraCadaUno([&](std::size_t i) { f(i, valores[i]); });
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    std::vector<Resultado<T, E>> ResultadoLote<T, E>::aResultados() const & {
+        std::vector<Resultado<T, E>> resultados;
+        resultados.reserve(valores.size());
+        auto fallo = fallos.begin();
+        for (std::size_t i = 0; i < valores.size(); ++i) {
+            if (fallo != fallos.end() && fallo->first == i) {
+                resultados.emplace_back(en_error, fallo->second);
+                ++fallo;
+            } else {
+                resultados.emplace_back(valores[i]);
+            }
+        }
+        return resultados;
+    }
+
+    template<typename T, typename E> requires opc::valor_en_lote<T>
+    std::vector<Resultado<T, E>> ResultadoLote<T, E>::aResultados() && {
+        std::vector<Resultado<T, E>> resultados;
+        resultados.reserve(valores.size());
+        auto fallo = fallos.begin();
+        for (std::size_t i = 0; i < valores.size(); ++i) {
+            if (fallo != fallos.end() && fallo->first == i) {
+                resultados.emplace_back(en_error, std::move(fallo->second));
+                ++fallo;
+            } else {
+                resultados.emplace_back(std::move(valores[i]));
+            }
+        }
+        *this = ResultadoLote();
+        return resultados;
+    }
+}
+#endif
@@ -0,0 +1,419 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define ERRORES_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#endif
+
+// Con GCC y Clang, cada núcleo se compila para su conjunto de instrucciones sin
+// exigirlo al resto del programa. MSVC admite los intrínsecos sin opciones.
+#if defined(__GNUC__) || defined(__clang__)
+    #define ERRORES_OBJETIVO(conjunto) __attribute__((target(conjunto)))
+#else
+    #define ERRORES_OBJETIVO(conjunto)
+#endif
+
+namespace simd { // Declaración
+    /**
+    * @brief Núcleos vectoriales sobre mapas de bits de presencia o validez.
+    *
+    * Operan sobre el formato de `opc::MapaBits`: el elemento `i` está presente si
+    * el bit `i % 64` de la palabra `i / 64` vale uno. Cada operación tiene una
+    * versión escalar, una SSE2 y una AVX2; la que se usa se elige en tiempo de
+    * ejecución según el procesador (`nivelDisponible()`). Fuera de x86 sólo existe
+    * la escalar.
+    *
+    * Las sobrecargas con un `Nivel` explícito permiten comparar las versiones; un
+    * nivel mayor que el disponible se reduce al disponible.
+    */
+    enum class Nivel : int { ESCALAR = 0, SSE2, AVX2 };
+
+    // Nivel más alto que soporta el procesador. Se detecta una sola vez.
+    Nivel nivelDisponible() noexcept;
+
+    // Elementos de 4 u 8 bytes que se pueden copiar bit a bit (`int32_t`, `int64_t`, `float`, `double`, ...).
+    template<typename T>
+    concept elemento_simd = std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+    // Cantidad de bits en uno en `palabras[0, cantidad)`.
+    std::size_t contarBits(const std::uint64_t* palabras, std::size_t cantidad) noexcept;
+    std::size_t contarBits(Nivel nivel, const std::uint64_t* palabras, std::size_t cantidad) noexcept;
+
+    // Copia a `destino`, en orden, los `datos[i]` presentes en `mapa`. Devuelve cuántos copió.
+    // `destino` debe tener lugar para `n` elementos: las versiones vectoriales escriben de a bloques.
+    template<elemento_simd T>
+    std::size_t compactar(const T* datos, const std::uint64_t* mapa, std::size_t n, T* destino) noexcept;
+    template<elemento_simd T>
+    std::size_t compactar(Nivel nivel, const T* datos, const std::uint64_t* mapa, std::size_t n, T* destino) noexcept;
+
+    // Reemplaza por `porDefecto` los `datos[i]` ausentes en `mapa`.
+    template<elemento_simd T>
+    void rellenar(T* datos, const std::uint64_t* mapa, std::size_t n, T porDefecto) noexcept;
+    template<elemento_simd T>
+    void rellenar(Nivel nivel, T* datos, const std::uint64_t* mapa, std::size_t n, T porDefecto) noexcept;
+
+    // `destino` = intersección (AND) de `columnas` mapas de `palabras` palabras cada uno.
+    void combinarMapas(std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t palabras) noexcept;
+    void combinarMapas(Nivel nivel, std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t palabras) noexcept;
+}
+
+namespace simd { // Implementación
+    namespace detalle {
+        inline bool bit(const std::uint64_t* mapa, std::size_t i) noexcept {
+            return (mapa[i / 64] >> (i % 64)) & 1u;
+        }
+
+        inline Nivel detectar() noexcept {
+            #if defined(ERRORES_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) return Nivel::AVX2;
+                if (__builtin_cpu_supports("sse2")) return Nivel::SSE2;
+            #elif defined(ERRORES_SIMD_X86) && defined(_MSC_VER)
+                int registros[4];
+                __cpuid(registros, 1);
+                bool sse2 = (registros[3] >> 26) & 1;
+                bool osxsave = (registros[2] >> 27) & 1;
+                __cpuidex(registros, 7, 0);
+                bool avx2 = (registros[1] >> 5) & 1;
+                // El sistema debe preservar los registros YMM (XCR0 bits 1 y 2).
+                if (avx2 && osxsave && (_xgetbv(0) & 0x6) == 0x6) return Nivel::AVX2;
+                if (sse2) return Nivel::SSE2;
+            #endif
+            return Nivel::ESCALAR;
+        }
+
+        /*
+         *  Escalar
+         */
+
+        inline std::size_t contarBitsEscalar(const std::uint64_t* palabras, std::size_t cantidad) noexcept {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < cantidad; ++i) {
+                total += static_cast<std::size_t>(std::popcount(palabras[i]));
+            }
+            return total;
+        }
+
+        // Sin saltos: siempre escribe y avanza el destino sólo si el elemento está presente.
+        template<typename T>
+        std::size_t compactarEscalar(const T* datos, const std::uint64_t* mapa, std::size_t desde, std::size_t hasta, T* destino, std::size_t k) noexcept {
+            for (std::size_t i = desde; i < hasta; ++i) {
+                destino[k] = datos[i];
+                k += bit(mapa, i);
+            }
+            return k;
+        }
+
+        template<typename T>
+        void rellenarEscalar(T* datos, const std::uint64_t* mapa, std::size_t desde, std::size_t hasta, T porDefecto) noexcept {
+            for (std::size_t i = desde; i < hasta; ++i) {
+                datos[i] = bit(mapa, i) ? datos[i] : porDefecto;
+            }
+        }
+
+        inline void combinarEscalar(std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t desde, std::size_t hasta) noexcept {
+            for (std::size_t p = desde; p < hasta; ++p) {
+                std::uint64_t palabra = mapas[0][p];
+                for (std::size_t c = 1; c < columnas; ++c) {
+                    palabra &= mapas[c][p];
+                }
+                destino[p] = palabra;
+            }
+        }
+
+        #if defined(ERRORES_SIMD_X86)
+        // Índices para `_mm256_permutevar8x32_epi32`: para cada máscara, los
+        // carriles presentes primero y en orden.
+        struct TablaCompactacion {
+            alignas(32) std::uint32_t de32[256][8];
+            alignas(32) std::uint32_t de64[16][8];
+        };
+
+        constexpr TablaCompactacion generarTabla() noexcept {
+            TablaCompactacion tabla{};
+            for (unsigned m = 0; m < 256; ++m) {
+                unsigned k = 0;
+                for (unsigned j = 0; j < 8; ++j) {
+                    if ((m >> j) & 1u) tabla.de32[m][k++] = j;
+                }
+            }
+            for (unsigned m = 0; m < 16; ++m) {
+                unsigned k = 0;
+                for (unsigned j = 0; j < 4; ++j) {
+                    if ((m >> j) & 1u) {
+                        tabla.de64[m][k++] = 2 * j;
+                        tabla.de64[m][k++] = 2 * j + 1;
+                    }
+                }
+            }
+            return tabla;
+        }
+
+        inline constexpr TablaCompactacion TABLA = generarTabla();
+
+        /*
+         *  SSE2
+         */
+
+        ERRORES_OBJETIVO("sse2")
+        inline std::size_t contarBitsSse2(const std::uint64_t* palabras, std::size_t cantidad) noexcept {
+            // Conteo por bytes en paralelo (SWAR) y suma horizontal con `psadbw`.
+            const __m128i m1 = _mm_set1_epi8(0x55), m2 = _mm_set1_epi8(0x33), m4 = _mm_set1_epi8(0x0F);
+            __m128i acumulado = _mm_setzero_si128();
+            std::size_t p = 0;
+            for (; p + 2 <= cantidad; p += 2) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(palabras + p));
+                v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+                v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+                v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+                acumulado = _mm_add_epi64(acumulado, _mm_sad_epu8(v, _mm_setzero_si128()));
+            }
+            alignas(16) std::uint64_t sumas[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(sumas), acumulado);
+            return static_cast<std::size_t>(sumas[0] + sumas[1]) + contarBitsEscalar(palabras + p, cantidad - p);
+        }
+
+        // SSE2 no tiene permutaciones variables: se copian enteras las palabras
+        // llenas, se saltean las vacías y el resto se compacta sin saltos.
+        template<typename T>
+        ERRORES_OBJETIVO("sse2")
+        std::size_t compactarSse2(const T* datos, const std::uint64_t* mapa, std::size_t n, T* destino) noexcept {
+            std::size_t k = 0;
+            const std::size_t completas = n / 64;
+            for (std::size_t p = 0; p < completas; ++p) {
+                const std::uint64_t palabra = mapa[p];
+                if (palabra == ~std::uint64_t{0}) {
+                    std::memcpy(destino + k, datos + p * 64, 64 * sizeof(T));
+                    k += 64;
+                } else if (palabra != 0) {
+                    k = compactarEscalar(datos, mapa, p * 64, p * 64 + 64, destino, k);
+                }
+            }
+            return compactarEscalar(datos, mapa, completas * 64, n, destino, k);
+        }
+
+        template<typename T>
+        ERRORES_OBJETIVO("sse2")
+        void rellenarSse2(T* datos, const std::uint64_t* mapa, std::size_t n, T porDefecto) noexcept {
+            __m128i relleno = _mm_setzero_si128();
+            std::memcpy(&relleno, &porDefecto, sizeof(T));
+            relleno = sizeof(T) == 4 ? _mm_shuffle_epi32(relleno, 0x00) : _mm_shuffle_epi32(relleno, 0x44);
+            // Bit de cada carril dentro del grupo (de 4 elementos de 32 bits o 2 de 64).
+            const __m128i bits = sizeof(T) == 4 ? _mm_set_epi32(8, 4, 2, 1) : _mm_set_epi32(2, 2, 1, 1);
+            constexpr std::size_t carriles = 16 / sizeof(T);
+
+            const std::size_t completas = n / 64;
+            for (std::size_t p = 0; p < completas; ++p) {
+                const std::uint64_t palabra = mapa[p];
+                if (palabra == ~std::uint64_t{0}) continue;
+                T* bloque = datos + p * 64;
+                for (std::size_t g = 0; g < 64 / carriles; ++g) {
+                    int grupo = static_cast<int>((palabra >> (g * carriles)) & ((1u << carriles) - 1));
+                    __m128i mascara = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(grupo), bits), bits);
+                    __m128i* direccion = reinterpret_cast<__m128i*>(bloque + g * carriles);
+                    __m128i v = _mm_loadu_si128(direccion);
+                    v = _mm_or_si128(_mm_and_si128(mascara, v), _mm_andnot_si128(mascara, relleno));
+                    _mm_storeu_si128(direccion, v);
+                }
+            }
+            rellenarEscalar(datos, mapa, completas * 64, n, porDefecto);
+        }
+
+        ERRORES_OBJETIVO("sse2")
+        inline void combinarSse2(std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t palabras) noexcept {
+            std::size_t p = 0;
+            for (; p + 2 <= palabras; p += 2) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mapas[0] + p));
+                for (std::size_t c = 1; c < columnas; ++c) {
+                    v = _mm_and_si128(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(mapas[c] + p)));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destino + p), v);
+            }
+            combinarEscalar(destino, mapas, columnas, p, palabras);
+        }
+
+        /*
+         *  AVX2
+         */
+
+        ERRORES_OBJETIVO("avx2")
+        inline std::size_t contarBitsAvx2(const std::uint64_t* palabras, std::size_t cantidad) noexcept {
+            // Conteo por nibbles con una tabla de 16 entradas (`vpshufb`) y suma con `vpsadbw`.
+            const __m256i tabla = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                   0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            __m256i acumulado = _mm256_setzero_si256();
+            std::size_t p = 0;
+            for (; p + 4 <= cantidad; p += 4) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(palabras + p));
+                __m256i bajos = _mm256_shuffle_epi8(tabla, _mm256_and_si256(v, nibble));
+                __m256i altos = _mm256_shuffle_epi8(tabla, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+                acumulado = _mm256_add_epi64(acumulado, _mm256_sad_epu8(_mm256_add_epi8(bajos, altos), _mm256_setzero_si256()));
+            }
+            alignas(32) std::uint64_t sumas[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(sumas), acumulado);
+            return static_cast<std::size_t>(sumas[0] + sumas[1] + sumas[2] + sumas[3]) + contarBitsEscalar(palabras + p, cantidad - p);
+        }
+
+        // Cada grupo de 8 (o 4) elementos se reordena con una permutación de la
+        // tabla y se escribe entero; el destino avanza sólo lo presente.
+        template<typename T>
+        ERRORES_OBJETIVO("avx2")
+        std::size_t compactarAvx2(const T* datos, const std::uint64_t* mapa, std::size_t n, T* destino) noexcept {
+            constexpr std::size_t carriles = 32 / sizeof(T);
+            std::size_t k = 0;
+            const std::size_t completas = n / 64;
+            for (std::size_t p = 0; p < completas; ++p) {
+                const std::uint64_t palabra = mapa[p];
+                const T* bloque = datos + p * 64;
+                if (palabra == ~std::uint64_t{0}) {
+                    std::memcpy(destino + k, bloque, 64 * sizeof(T));
+                    k += 64;
+                    continue;
+                }
+                if (palabra == 0) continue;
+                for (std::size_t g = 0; g < 64 / carriles; ++g) {
+                    unsigned grupo = static_cast<unsigned>((palabra >> (g * carriles)) & ((1u << carriles) - 1));
+                    const std::uint32_t* indices = sizeof(T) == 4 ? TABLA.de32[grupo] : TABLA.de64[grupo];
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bloque + g * carriles));
+                    v = _mm256_permutevar8x32_epi32(v, _mm256_load_si256(reinterpret_cast<const __m256i*>(indices)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino + k), v);
+                    k += static_cast<std::size_t>(std::popcount(grupo));
+                }
+            }
+            return compactarEscalar(datos, mapa, completas * 64, n, destino, k);
+        }
+
+        template<typename T>
+        ERRORES_OBJETIVO("avx2")
+        void rellenarAvx2(T* datos, const std::uint64_t* mapa, std::size_t n, T porDefecto) noexcept {
+            constexpr std::size_t carriles = 32 / sizeof(T);
+            __m256i relleno, bits;
+            if constexpr (sizeof(T) == 4) {
+                std::int32_t patron;
+                std::memcpy(&patron, &porDefecto, sizeof(T));
+                relleno = _mm256_set1_epi32(patron);
+                bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            } else {
+                long long patron;
+                std::memcpy(&patron, &porDefecto, sizeof(T));
+                relleno = _mm256_set1_epi64x(patron);
+                bits = _mm256_setr_epi64x(1, 2, 4, 8);
+            }
+
+            const std::size_t completas = n / 64;
+            for (std::size_t p = 0; p < completas; ++p) {
+                const std::uint64_t palabra = mapa[p];
+                if (palabra == ~std::uint64_t{0}) continue;
+                T* bloque = datos + p * 64;
+                for (std::size_t g = 0; g < 64 / carriles; ++g) {
+                    int grupo = static_cast<int>((palabra >> (g * carriles)) & ((1u << carriles) - 1));
+                    __m256i mascara = sizeof(T) == 4
+                        ? _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(grupo), bits), bits)
+                        : _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(grupo), bits), bits);
+                    __m256i* direccion = reinterpret_cast<__m256i*>(bloque + g * carriles);
+                    _mm256_storeu_si256(direccion, _mm256_blendv_epi8(relleno, _mm256_loadu_si256(direccion), mascara));
+                }
+            }
+            rellenarEscalar(datos, mapa, completas * 64, n, porDefecto);
+        }
+
+        ERRORES_OBJETIVO("avx2")
+        inline void combinarAvx2(std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t palabras) noexcept {
+            std::size_t p = 0;
+            for (; p + 4 <= palabras; p += 4) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mapas[0] + p));
+                for (std::size_t c = 1; c < columnas; ++c) {
+                    v = _mm256_and_si256(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mapas[c] + p)));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino + p), v);
+            }
+            combinarEscalar(destino, mapas, columnas, p, palabras);
+        }
+        #endif
+
+        inline Nivel acotar(Nivel nivel) noexcept {
+            return std::min(nivel, nivelDisponible());
+        }
+    }
+
+    inline Nivel nivelDisponible() noexcept {
+        static const Nivel nivel = detalle::detectar();
+        return nivel;
+    }
+
+    inline std::size_t contarBits(Nivel nivel, const std::uint64_t* palabras, std::size_t cantidad) noexcept {
+        switch (detalle::acotar(nivel)) {
+            #if defined(ERRORES_SIMD_X86)
+            case Nivel::AVX2: return detalle::contarBitsAvx2(palabras, cantidad);
+            case Nivel::SSE2: return detalle::contarBitsSse2(palabras, cantidad);
+            #endif
+            default: return detalle::contarBitsEscalar(palabras, cantidad);
+        }
+    }
+
+    inline std::size_t contarBits(const std::uint64_t* palabras, std::size_t cantidad) noexcept {
+        return contarBits(nivelDisponible(), palabras, cantidad);
+    }
+
+    template<elemento_simd T>
+    std::size_t compactar(Nivel nivel, const T* datos, const std::uint64_t* mapa, std::size_t n, T* destino) noexcept {
+        switch (detalle::acotar(nivel)) {
+            #if defined(ERRORES_SIMD_X86)
+            case Nivel::AVX2: return detalle::compactarAvx2(datos, mapa, n, destino);
+            case Nivel::SSE2: return detalle::compactarSse2(datos, mapa, n, destino);
+            #endif
+            default: return detalle::compactarEscalar(datos, mapa, 0, n, destino, 0);
+        }
+    }
+
+    template<elemento_simd T>
+    std::size_t compactar(const T* datos, const std::uint64_t* mapa, std::size_t n, T* destino) noexcept {
+        return compactar(nivelDisponible(), datos, mapa, n, destino);
+    }
+
+    template<elemento_simd T>
+    void rellenar(Nivel nivel, T* datos, const std::uint64_t* mapa, std::size_t n, T porDefecto) noexcept {
+        switch (detalle::acotar(nivel)) {
+            #if defined(ERRORES_SIMD_X86)
+            case Nivel::AVX2: detalle::rellenarAvx2(datos, mapa, n, porDefecto); return;
+            case Nivel::SSE2: detalle::rellenarSse2(datos, mapa, n, porDefecto); return;
+            #endif
+            default: detalle::rellenarEscalar(datos, mapa, 0, n, porDefecto); return;
+        }
+    }
+
+    template<elemento_simd T>
+    void rellenar(T* datos, const std::uint64_t* mapa, std::size_t n, T porDefecto) noexcept {
+        rellenar(nivelDisponible(), datos, mapa, n, porDefecto);
+    }
+
+    inline void combinarMapas(Nivel nivel, std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t palabras) noexcept {
+        if (columnas == 0) {
+            return;
+        }
+        switch (detalle::acotar(nivel)) {
+            #if defined(ERRORES_SIMD_X86)
+            case Nivel::AVX2: detalle::combinarAvx2(destino, mapas, columnas, palabras); return;
+            case Nivel::SSE2: detalle::combinarSse2(destino, mapas, columnas, palabras); return;
+            #endif
+            default: detalle::combinarEscalar(destino, mapas, columnas, 0, palabras); return;
+        }
+    }
+
+    inline void combinarMapas(std::uint64_t* destino, const std::uint64_t* const* mapas, std::size_t columnas, std::size_t palabras) noexcept {
+        combinarMapas(nivelDisponible(), destino, mapas, columnas, palabras);
+    }
+}
+#endif
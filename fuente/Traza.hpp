@@ -0,0 +1,183 @@
+#ifndef TRAZA_HPP
+#define TRAZA_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Política de captura de trazas compilada: 0 (nunca), 1 (sólo errores fatales) o
+// 2 (todos los errores). Es el máximo que puede elegirse en tiempo de ejecución;
+// con 0 la traza desaparece por completo.
+#ifndef ERRORES_TRAZA
+    #define ERRORES_TRAZA 0
+#endif
+// Política con que arranca el programa; por defecto, la compilada.
+#ifndef ERRORES_TRAZA_INICIAL
+    #define ERRORES_TRAZA_INICIAL ERRORES_TRAZA
+#endif
+// Cantidad máxima de marcos que se guardan por error.
+#ifndef ERRORES_TRAZA_PROFUNDIDAD
+    #define ERRORES_TRAZA_PROFUNDIDAD 16
+#endif
+
+// Con GCC y Clang se recorre la pila con el desenrollador de la ABI de Itanium.
+// En otros compiladores la traza existe pero queda siempre vacía.
+#if ERRORES_TRAZA > 0 && (defined(__GNUC__) || defined(__clang__))
+    #define ERRORES_TRAZA_DESENROLLADOR 1
+    #include <cxxabi.h>
+    #include <dlfcn.h>
+    #include <unwind.h>
+#endif
+
+namespace err::traza { // Declaración
+    enum class Politica : int { NUNCA = 0, FATALES = 1, TODOS = 2 };
+
+    // La política más amplia disponible, fijada al compilar con `ERRORES_TRAZA`.
+    inline constexpr Politica MAXIMA = static_cast<Politica>(ERRORES_TRAZA);
+
+    // Cambia la política en tiempo de ejecución, acotada a `MAXIMA`. Devuelve la anterior.
+    Politica establecerPolitica(Politica politica) noexcept;
+    Politica politica() noexcept;
+
+    /**
+     * @brief Direcciones de retorno de la pila, tomadas al construir un error.
+     *
+     * Se guardan en un arreglo de tamaño fijo dentro de la carga compartida del
+     * `Error`, que se reserva sólo si se capturó algún marco. Capturar no resuelve
+     * símbolos, sólo recorre la pila. Los nombres se buscan recién al imprimir la
+     * traza (`escribir`), que es cuando se necesitan.
+     *
+     * @note La primera captura de un proceso puede inicializar el desenrollador.
+     */
+    class Traza {
+        public:
+        Traza() noexcept = default;
+        // Copian sólo los marcos capturados: el resto del arreglo no está inicializado.
+        Traza(const Traza& otra) noexcept : cantidad(otra.cantidad) { std::copy_n(otra.marcos, cantidad, marcos); };
+        Traza& operator=(const Traza& otra) noexcept;
+        // Captura la pila si la política vigente lo pide para un error de esa severidad.
+        static Traza capturar(bool fatal) noexcept;
+
+        std::size_t tamano() const noexcept { return cantidad; };
+        bool vacia() const noexcept { return cantidad == 0; };
+        const void* operator[](std::size_t i) const noexcept { return marcos[i]; };
+
+        // Agrega a `destino` un marco por línea: `  #i símbolo+desplazamiento [dirección]`.
+        void escribir(std::string& destino) const;
+
+        private:
+        const void* marcos[ERRORES_TRAZA_PROFUNDIDAD];
+        std::uint32_t cantidad = 0;
+    };
+
+    // Lo que guarda la carga de un `Error` cuando `ERRORES_TRAZA` es 0: nada.
+    struct SinTraza {
+        static constexpr SinTraza capturar(bool) noexcept { return {}; };
+        constexpr std::size_t tamano() const noexcept { return 0; };
+        constexpr bool vacia() const noexcept { return true; };
+        void escribir(std::string&) const {};
+    };
+}
+
+namespace err {
+#if ERRORES_TRAZA > 0
+    using Traza = traza::Traza;
+#else
+    using Traza = traza::SinTraza;
+#endif
+}
+
+namespace err::traza { // Implementación
+    namespace detalle {
+        inline std::atomic<Politica> vigente{static_cast<Politica>(std::min(ERRORES_TRAZA_INICIAL, ERRORES_TRAZA))};
+
+        #if defined(ERRORES_TRAZA_DESENROLLADOR)
+        struct Recorrido {
+            const void** marcos;
+            std::uint32_t cantidad;
+            // Marcos propios de la captura, que no interesan.
+            std::uint32_t saltar;
+        };
+
+        inline _Unwind_Reason_Code paso(_Unwind_Context* contexto, void* arg) {
+            Recorrido* recorrido = static_cast<Recorrido*>(arg);
+            std::uintptr_t ip = _Unwind_GetIP(contexto);
+            if (ip == 0) {
+                return _URC_END_OF_STACK;
+            }
+            if (recorrido->saltar > 0) {
+                --recorrido->saltar;
+                return _URC_NO_REASON;
+            }
+            recorrido->marcos[recorrido->cantidad++] = reinterpret_cast<const void*>(ip);
+            return recorrido->cantidad == ERRORES_TRAZA_PROFUNDIDAD ? _URC_END_OF_STACK : _URC_NO_REASON;
+        }
+        #endif
+    }
+
+    inline Politica establecerPolitica(Politica nueva) noexcept {
+        return detalle::vigente.exchange(std::min(nueva, MAXIMA), std::memory_order_relaxed);
+    }
+
+    inline Politica politica() noexcept {
+        return detalle::vigente.load(std::memory_order_relaxed);
+    }
+
+    inline Traza Traza::capturar(bool fatal) noexcept {
+        Traza traza;
+        if constexpr (MAXIMA == Politica::FATALES) {
+            // Compilada sólo para fatales: los demás errores ni consultan la política.
+            if (!fatal) return traza;
+        }
+        if (politica() < (fatal ? Politica::FATALES : Politica::TODOS)) {
+            return traza;
+        }
+        #if defined(ERRORES_TRAZA_DESENROLLADOR)
+            detalle::Recorrido recorrido{traza.marcos, 0, 1};
+            _Unwind_Backtrace(detalle::paso, &recorrido);
+            traza.cantidad = recorrido.cantidad;
+        #endif
+        return traza;
+    }
+
+    inline Traza& Traza::operator=(const Traza& otra) noexcept {
+        if (this != &otra) {
+            std::copy_n(otra.marcos, otra.cantidad, marcos);
+            cantidad = otra.cantidad;
+        }
+        return *this;
+    }
+
+    inline void Traza::escribir(std::string& destino) const {
+        char linea[64];
+        for (std::uint32_t i = 0; i < cantidad; ++i) {
+            std::snprintf(linea, sizeof(linea), "  #%u ", static_cast<unsigned>(i));
+            destino.append(linea);
+            #if defined(ERRORES_TRAZA_DESENROLLADOR)
+                // La dirección de retorno apunta a la instrucción siguiente a la llamada.
+                const char* direccion = static_cast<const char*>(marcos[i]) - 1;
+                Dl_info info{};
+                if (dladdr(direccion, &info) != 0 && info.dli_sname != nullptr) {
+                    int estado = 0;
+                    char* legible = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &estado);
+                    destino.append(estado == 0 && legible != nullptr ? legible : info.dli_sname);
+                    std::free(legible);
+                    std::snprintf(linea, sizeof(linea), "+0x%zx", static_cast<std::size_t>(direccion + 1 - static_cast<const char*>(info.dli_saddr)));
+                    destino.append(linea);
+                } else if (info.dli_fname != nullptr) {
+                    // Sin símbolo exportado: módulo y desplazamiento, para `addr2line`.
+                    destino.append(info.dli_fname);
+                    std::snprintf(linea, sizeof(linea), "+0x%zx", static_cast<std::size_t>(direccion + 1 - static_cast<const char*>(info.dli_fbase)));
+                    destino.append(linea);
+                }
+            #endif
+            std::snprintf(linea, sizeof(linea), " [%p]\n", marcos[i]);
+            destino.append(linea);
+        }
+    }
+}
+#endif
@@ -4,4 +4,12 @@
 #include "Error.hpp"
 #include "Opcion.hpp"
 #include "Resultado.hpp"
+#include "Corrutinas.hpp"
+#include "ResultadoAsync.hpp"
+#include "GrupoHilos.hpp"
+#include "Recoleccion.hpp"
+#include "Simd.hpp"
+#include "OpcionLote.hpp"
+#include "OpcionAtomica.hpp"
+#include "ResultadoLote.hpp"
 #endif
\ No newline at end of file
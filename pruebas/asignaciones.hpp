@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/****************************************************************
+ *                CONTADOR DE ASIGNACIONES                      *
+ * ------------------------------------------------------------ *
+ *   Reemplaza el `operator new` global para contar cuántas     *
+ *   reservas de memoria dinámica se realizan. Debe incluirse   *
+ *   en una única unidad de traducción por ejecutable.          *
+ ***************************************************************/
+
+namespace pruebas {
+    inline std::atomic<std::size_t> asignaciones{0};
+
+    // Cuenta las asignaciones realizadas desde su construcción.
+    struct ContadorAsignaciones {
+        std::size_t inicio = asignaciones.load(std::memory_order_relaxed);
+        std::size_t cuenta() const noexcept {
+            return asignaciones.load(std::memory_order_relaxed) - inicio;
+        }
+    };
+}
+
+namespace pruebas::detalle {
+    // Cada reemplazo reserva aquí y libera con `std::free`: ningún `delete` recibe
+    // un puntero que el compilador vea salir de otro `operator new`.
+    inline void* reservar(std::size_t n, std::size_t alineacion = 0) {
+        asignaciones.fetch_add(1, std::memory_order_relaxed);
+        if (n == 0) n = 1;
+        void* p = alineacion == 0
+            ? std::malloc(n)
+            : std::aligned_alloc(alineacion, (n + alineacion - 1) / alineacion * alineacion);
+        if (p == nullptr) throw std::bad_alloc();
+        return p;
+    }
+}
+
+// Los reemplazos no se expanden en línea: si un `delete` se expande, GCC ve un
+// `std::free` sobre un puntero de `operator new` y advierte `-Wmismatched-new-delete`
+// (con -O1 y -Os).
+#if defined(__GNUC__)
+    #define PRUEBAS_NO_EN_LINEA __attribute__((noinline))
+#else
+    #define PRUEBAS_NO_EN_LINEA
+#endif
+
+PRUEBAS_NO_EN_LINEA void* operator new(std::size_t n) { return pruebas::detalle::reservar(n); }
+PRUEBAS_NO_EN_LINEA void* operator new[](std::size_t n) { return pruebas::detalle::reservar(n); }
+PRUEBAS_NO_EN_LINEA void* operator new(std::size_t n, std::align_val_t a) { return pruebas::detalle::reservar(n, static_cast<std::size_t>(a)); }
+PRUEBAS_NO_EN_LINEA void* operator new[](std::size_t n, std::align_val_t a) { return pruebas::detalle::reservar(n, static_cast<std::size_t>(a)); }
+PRUEBAS_NO_EN_LINEA void* operator new(std::size_t n, const std::nothrow_t&) noexcept {
+    try { return pruebas::detalle::reservar(n); } catch (const std::bad_alloc&) { return nullptr; }
+}
+PRUEBAS_NO_EN_LINEA void* operator new[](std::size_t n, const std::nothrow_t&) noexcept {
+    try { return pruebas::detalle::reservar(n); } catch (const std::bad_alloc&) { return nullptr; }
+}
+PRUEBAS_NO_EN_LINEA void operator delete(void* p) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete[](void* p) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+PRUEBAS_NO_EN_LINEA void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
@@ -0,0 +1,124 @@
+#pragma once
+#include "errores--.hpp"
+
+/****************************************************************
+ *                  CADENA DE VALIDACIÓN                        *
+ * ------------------------------------------------------------ *
+ *   La misma validación de 12 etapas escrita con combinadores  *
+ *   y como cascada de `if`. La usan las pruebas, la medición   *
+ *   de rendimiento y la comparación de código generado         *
+ *   (`codegen_combinadores.cpp`). `validacion::generico` la    *
+ *   repite con `err::Error`, cuyo destructor no es trivial.    *
+ ***************************************************************/
+
+namespace validacion {
+    enum class Fallo : int { NINGUNO = 0, NEGATIVO, DEMASIADO_GRANDE, MULTIPLO_PROHIBIDO, FUERA_DE_RANGO, IMPAR };
+
+    using ResultadoValidacion = res::Resultado<int, Fallo>;
+
+    inline ResultadoValidacion noNegativo(int x) {
+        return x < 0 ? ResultadoValidacion(res::en_error, Fallo::NEGATIVO) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion acotado(int x) {
+        return x >= 2'000'000 ? ResultadoValidacion(res::en_error, Fallo::DEMASIADO_GRANDE) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion noMultiploDeSiete(int x) {
+        return x % 7 == 0 ? ResultadoValidacion(res::en_error, Fallo::MULTIPLO_PROHIBIDO) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion enRango(int x) {
+        return (x < 10 || x > 1'000'000) ? ResultadoValidacion(res::en_error, Fallo::FUERA_DE_RANGO) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion par(int x) {
+        return x % 2 != 0 ? ResultadoValidacion(res::en_error, Fallo::IMPAR) : ResultadoValidacion(x);
+    }
+
+    inline ResultadoValidacion encadenado(int x) {
+        return noNegativo(x)
+            .mapear([](int v) { return v * 2; })
+            .yLuego(acotado)
+            .mapear([](int v) { return v + 7; })
+            .yLuego(noMultiploDeSiete)
+            .mapear([](int v) { return v / 3; })
+            .yLuego(enRango)
+            .mapear([](int v) { return v - 1; })
+            .oSino([](Fallo f) { return f == Fallo::FUERA_DE_RANGO ? ResultadoValidacion(10) : ResultadoValidacion(res::en_error, f); })
+            .mapear([](int v) { return v & ~1; })
+            .yLuego(par)
+            .transformarError([](Fallo f) { return f == Fallo::IMPAR ? Fallo::FUERA_DE_RANGO : f; });
+    }
+
+    inline ResultadoValidacion cascada(int x) {
+        if (x < 0) return ResultadoValidacion(res::en_error, Fallo::NEGATIVO);
+        x = x * 2;
+        if (x >= 2'000'000) return ResultadoValidacion(res::en_error, Fallo::DEMASIADO_GRANDE);
+        x = x + 7;
+        if (x % 7 == 0) return ResultadoValidacion(res::en_error, Fallo::MULTIPLO_PROHIBIDO);
+        x = x / 3;
+        if (x < 10 || x > 1'000'000) {
+            x = 10;
+        } else {
+            x = x - 1;
+        }
+        x = x & ~1;
+        if (x % 2 != 0) return ResultadoValidacion(res::en_error, Fallo::FUERA_DE_RANGO);
+        return ResultadoValidacion(x);
+    }
+}
+
+namespace validacion::generico {
+    inline constexpr err::Descriptor NEGATIVO{err::ERROR, "validacion", "Negativo"};
+    inline constexpr err::Descriptor DEMASIADO_GRANDE{err::ERROR, "validacion", "Demasiado grande"};
+    inline constexpr err::Descriptor MULTIPLO_PROHIBIDO{err::ERROR, "validacion", "Múltiplo prohibido"};
+    inline constexpr err::Descriptor FUERA_DE_RANGO{err::ERROR, "validacion", "Fuera de rango"};
+    inline constexpr err::Descriptor IMPAR{err::ERROR, "validacion", "Impar"};
+
+    using ResultadoValidacion = res::Resultado<int>;
+
+    inline ResultadoValidacion noNegativo(int x) {
+        return x < 0 ? ResultadoValidacion(err::Error(NEGATIVO)) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion acotado(int x) {
+        return x >= 2'000'000 ? ResultadoValidacion(err::Error(DEMASIADO_GRANDE)) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion noMultiploDeSiete(int x) {
+        return x % 7 == 0 ? ResultadoValidacion(err::Error(MULTIPLO_PROHIBIDO)) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion enRango(int x) {
+        return (x < 10 || x > 1'000'000) ? ResultadoValidacion(err::Error(FUERA_DE_RANGO)) : ResultadoValidacion(x);
+    }
+    inline ResultadoValidacion par(int x) {
+        return x % 2 != 0 ? ResultadoValidacion(err::Error(IMPAR)) : ResultadoValidacion(x);
+    }
+
+    inline ResultadoValidacion encadenado(int x) {
+        return noNegativo(x)
+            .mapear([](int v) { return v * 2; })
+            .yLuego(acotado)
+            .mapear([](int v) { return v + 7; })
+            .yLuego(noMultiploDeSiete)
+            .mapear([](int v) { return v / 3; })
+            .yLuego(enRango)
+            .mapear([](int v) { return v - 1; })
+            .oSino([](err::Error&& e) { return e == FUERA_DE_RANGO ? ResultadoValidacion(10) : ResultadoValidacion(std::move(e)); })
+            .mapear([](int v) { return v & ~1; })
+            .yLuego(par)
+            .transformarError([](err::Error&& e) { return e == IMPAR ? err::Error(FUERA_DE_RANGO) : std::move(e); });
+    }
+
+    inline ResultadoValidacion cascada(int x) {
+        if (x < 0) return ResultadoValidacion(err::Error(NEGATIVO));
+        x = x * 2;
+        if (x >= 2'000'000) return ResultadoValidacion(err::Error(DEMASIADO_GRANDE));
+        x = x + 7;
+        if (x % 7 == 0) return ResultadoValidacion(err::Error(MULTIPLO_PROHIBIDO));
+        x = x / 3;
+        if (x < 10 || x > 1'000'000) {
+            x = 10;
+        } else {
+            x = x - 1;
+        }
+        x = x & ~1;
+        if (x % 2 != 0) return ResultadoValidacion(err::Error(FUERA_DE_RANGO));
+        return ResultadoValidacion(x);
+    }
+}
@@ -0,0 +1,29 @@
+#include "cadena_validacion.hpp"
+
+/****************************************************************
+ *            CÓDIGO GENERADO: COMBINADORES VS. IF              *
+ * ------------------------------------------------------------ *
+ *   Unidad sin `main`: sólo expone las dos versiones de la     *
+ *   cadena de validación para comparar su tamaño, p. ej.:      *
+ *       nm -S --size-sort -C codegen_combinadores.cpp.o        *
+ *   o su ensamblador con `-S`. Las cifras medidas, por nivel   *
+ *   de optimización y tipo de error, están en Pruebas.md.      *
+ ***************************************************************/
+
+// Error trivial (`Fallo`, un `enum` de 4 bytes).
+validacion::ResultadoValidacion validarEncadenado(int x) {
+    return validacion::encadenado(x);
+}
+
+validacion::ResultadoValidacion validarCascada(int x) {
+    return validacion::cascada(x);
+}
+
+// `err::Error`: con destructor y copia no triviales.
+validacion::generico::ResultadoValidacion validarEncadenadoGenerico(int x) {
+    return validacion::generico::encadenado(x);
+}
+
+validacion::generico::ResultadoValidacion validarCascadaGenerico(int x) {
+    return validacion::generico::cascada(x);
+}
@@ -4,8 +4,27 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <limits>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include "errores--.hpp"
+#include "asignaciones.hpp"
+#include "cadena_validacion.hpp"
 
 /****************************************************************
  *                      EJEMPLOS BÁSICOS                        *
@@ -104,6 +123,423 @@ struct DatosPrueba {
     explicit DatosPrueba(int v) : valor(v) {}
 };
 
+/****************************************************************
+ *                    PRUEBAS DE ERROR                          *
+ ****************************************************************/
+
+TEST_CASE("Error con mensaje perezoso", "[error][mensaje]") {
+    SECTION("Mensaje literal") {
+        err::Error e = err::Generico("Entrada vacía");
+        REQUIRE(e);
+        REQUIRE(e.Mensaje() == "[-1] Entrada vacía\n");
+        REQUIRE(std::string(static_cast<const char*>(e)) == e.Mensaje());
+    }
+
+    SECTION("Mensaje dinámico y agregado") {
+        std::string dinamico = "Puerto " + std::to_string(8080);
+        err::Error e(err::FATAL, dinamico);
+        e.agregarMensaje("reintentar");
+        REQUIRE(e.Mensaje() == "[-2] Puerto 8080\nreintentar");
+
+        std::ostringstream os;
+        os << e;
+        REQUIRE(os.str() == e.Mensaje());
+    }
+
+    SECTION("Cadena de contexto compartida") {
+        err::Error base = err::Generico("sin conexión");
+        base.agregarMensaje("al abrir el socket\n");
+        err::Error copia = base;
+        copia.agregarMensaje("al cargar la configuración\n");
+        REQUIRE(base.Contexto() == std::vector<std::string_view>{"al abrir el socket\n"});
+        REQUIRE(copia.Contexto().size() == 2);
+        REQUIRE(copia.Mensaje() == "[-1] sin conexión\nal abrir el socket\nal cargar la configuración\n");
+        REQUIRE(base.Mensaje() == "[-1] sin conexión\nal abrir el socket\n");
+    }
+
+    SECTION("Envolver otro error") {
+        err::Error original(err::FATAL, std::string("disco lleno"));
+        original.agregarMensaje("al guardar\n");
+        err::Error envoltorio(&original);
+        envoltorio.agregarMensaje("al cerrar la sesión\n");
+        REQUIRE(envoltorio.Codigo() == err::FATAL);
+        REQUIRE(envoltorio.Mensaje() == "[-2] disco lleno\nal guardar\nal cerrar la sesión\n");
+        REQUIRE(original.Mensaje() == "[-2] disco lleno\nal guardar\n");
+
+        err::Error catalogado(err::catalogo::CANCELADO);
+        REQUIRE(err::Error(&catalogado) == err::catalogo::CANCELADO);
+        REQUIRE(err::Error(nullptr).Codigo() == err::ERROR);
+    }
+
+    SECTION("Exito") {
+        err::Error e = err::Exito();
+        REQUIRE(!e);
+        REQUIRE(e.Mensaje() == "[0] Exito\n");
+    }
+
+    SECTION("Sólo los literales y los arreglos estáticos se guardan como vista") {
+        STATIC_REQUIRE(!err::texto_dinamico<const char (&)[8]>);
+        STATIC_REQUIRE(err::texto_dinamico<char (&)[8]>);
+        STATIC_REQUIRE(err::texto_dinamico<const char*>);
+
+        static constexpr char fijo[] = "Mensaje fijo";
+        pruebas::ContadorAsignaciones contador;
+        err::Error estatico(err::ERROR, fijo);
+        REQUIRE(contador.cuenta() == 0);
+        REQUIRE(estatico.Mensaje() == "[-1] Mensaje fijo\n");
+
+        // Un arreglo más grande que su contenido: sólo cuenta hasta el primer nulo.
+        static const char parcial[32] = "abc";
+        REQUIRE(err::Generico(parcial).Mensaje() == "[-1] abc\n");
+        REQUIRE(err::Generico(parcial).Mensaje().size() == 9);
+    }
+
+    SECTION("Un arreglo constante local se copia") {
+        err::Error e;
+        {
+            const char local[] = "temporal";
+            e = err::Generico(local);
+            REQUIRE(e.Mensaje() == "[-1] temporal\n");
+        }
+        // Dentro de un objeto en el montículo: tampoco es estático.
+        struct ConTexto { const char texto[32] = "en el montículo"; };
+        auto objeto = std::make_unique<ConTexto>();
+        err::Error otro(err::FATAL, objeto->texto);
+        objeto.reset();
+        REQUIRE(e.Mensaje() == "[-1] temporal\n");
+        REQUIRE(otro.Mensaje() == "[-2] en el montículo\n");
+    }
+
+    SECTION("Un búfer se copia") {
+        char bufer[32];
+        std::snprintf(bufer, sizeof(bufer), "intento %d", 3);
+        err::Error e = err::Generico(bufer);
+        err::Error directo(err::FATAL, bufer);
+        std::snprintf(bufer, sizeof(bufer), "sobrescrito");
+        REQUIRE(e.Mensaje() == "[-1] intento 3\n");
+        REQUIRE(directo.Mensaje() == "[-2] intento 3\n");
+    }
+}
+
+TEST_CASE("Error con carga compartida", "[error][carga]") {
+    SECTION("Copiar no reserva memoria") {
+        err::Error original(err::ERROR, std::string(64, 'x'));
+        original.agregarMensaje("al leer\n");
+        pruebas::ContadorAsignaciones contador;
+        err::Error copia = original;
+        err::Error asignada;
+        asignada = copia;
+        std::tuple<err::Error> tupla(asignada);
+        REQUIRE(contador.cuenta() == 0);
+        REQUIRE(std::get<0>(tupla).Mensaje() == original.Mensaje());
+    }
+
+    SECTION("Las copias comparten el texto decorado") {
+        err::Error e = err::Fatal("Sin memoria");
+        err::Error copia = e;
+        const char* texto = static_cast<const char*>(e);
+        REQUIRE(std::string(texto) == "[-2] Sin memoria\n");
+        err::Error otra = e;
+        REQUIRE(static_cast<const char*>(otra) == texto);
+        REQUIRE(std::string(static_cast<const char*>(copia)) == texto);
+    }
+
+    SECTION("Un éxito no lleva carga") {
+        std::string mensaje(64, 'x');
+        std::string contexto = "al cargar la configuración\n";
+        std::string otroContexto = contexto;
+        pruebas::ContadorAsignaciones contador;
+        err::Error dinamico = err::Exito(std::move(mensaje));
+        err::Error literal = err::Exito("Archivo leído");
+        err::Error conDominio(err::EXITO, err::dominios::SISTEMA, 0);
+        dinamico.agregarMensaje(std::move(contexto));
+        literal.agregarMensaje(std::move(otroContexto));
+        REQUIRE(contador.cuenta() == 0);
+        REQUIRE(!dinamico);
+        REQUIRE(!conDominio);
+        // El texto dinámico se descarta; el literal, que no ocupa carga, se conserva.
+        REQUIRE(dinamico.Mensaje() == "[0] Exito\n");
+        REQUIRE(conDominio.Mensaje() == "[0] Exito\n");
+        REQUIRE(literal.Mensaje() == "[0] Archivo leído\n");
+        REQUIRE(dinamico.Contexto().empty());
+        REQUIRE(literal.Contexto().empty());
+    }
+
+    SECTION("Un éxito de catálogo no lleva carga") {
+        pruebas::ContadorAsignaciones contador;
+        err::Error e = err::Exito();
+        err::Error copia = e;
+        REQUIRE(contador.cuenta() == 0);
+        REQUIRE(copia == err::catalogo::EXITO);
+    }
+
+    SECTION("Copias que pasan entre hilos") {
+        err::Error base(err::ERROR, std::string("sin conexión"));
+        base.agregarMensaje("al abrir el socket\n");
+        const std::string esperado = base.Mensaje();
+        std::atomic<int> correctos{0};
+        std::vector<std::thread> hilos;
+        for (int h = 0; h < 4; ++h) {
+            hilos.emplace_back([&, h] {
+                for (int i = 0; i < 1000; ++i) {
+                    err::Error copia = base;
+                    if (i % 100 == 0) {
+                        copia.agregarMensaje("en el hilo " + std::to_string(h) + "\n");
+                    }
+                    err::Error movida = std::move(copia);
+                    if (movida.Mensaje().starts_with(esperado) && std::string(static_cast<const char*>(base)) == esperado) {
+                        correctos.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (auto& hilo : hilos) {
+            hilo.join();
+        }
+        REQUIRE(correctos.load() == 4000);
+        REQUIRE(base.Mensaje() == esperado);
+    }
+}
+
+namespace catalogo_prueba {
+    inline constexpr err::Descriptor DIVISION_POR_CERO{err::ERROR, "aritmetica", "No se puede dividir por cero"};
+    inline constexpr err::Descriptor DESBORDE{err::FATAL, "aritmetica", "Desborde"};
+}
+
+TEST_CASE("Error a partir de un descriptor estático", "[error][catalogo]") {
+    STATIC_REQUIRE(std::is_trivially_copyable_v<err::ErrorEstatico>);
+    STATIC_REQUIRE(sizeof(err::ErrorEstatico) == sizeof(void*));
+
+    SECTION("Identidad") {
+        err::ErrorEstatico a = catalogo_prueba::DIVISION_POR_CERO;
+        err::ErrorEstatico b = catalogo_prueba::DIVISION_POR_CERO;
+        err::ErrorEstatico c = catalogo_prueba::DESBORDE;
+        REQUIRE(a == b);
+        REQUIRE(!(a == c));
+        REQUIRE(a == catalogo_prueba::DIVISION_POR_CERO);
+        REQUIRE(a.Categoria() == "aritmetica");
+        REQUIRE(c.Codigo() == err::FATAL);
+    }
+
+    SECTION("Conversión a Error") {
+        err::Error e = err::ErrorEstatico(catalogo_prueba::DIVISION_POR_CERO);
+        REQUIRE(e);
+        REQUIRE(e == catalogo_prueba::DIVISION_POR_CERO);
+        REQUIRE(e.Origen() == &catalogo_prueba::DIVISION_POR_CERO);
+        REQUIRE(e.Mensaje() == "[-1] No se puede dividir por cero\n");
+        REQUIRE(e.Mensaje() == err::ErrorEstatico(catalogo_prueba::DIVISION_POR_CERO).Mensaje());
+
+        err::Error dinamico(err::ERROR, std::string("No se puede dividir por cero"));
+        REQUIRE(dinamico.Origen() == nullptr);
+        REQUIRE(!(dinamico == catalogo_prueba::DIVISION_POR_CERO));
+    }
+
+    SECTION("Funciones utilitarias sin mensaje") {
+        REQUIRE(err::Generico() == err::catalogo::ERROR);
+        REQUIRE(err::Fatal() == err::catalogo::FATAL);
+        REQUIRE(err::Exito() == err::catalogo::EXITO);
+    }
+}
+
+namespace dominio_prueba {
+    enum CodigoRed { RECHAZADA = 1, AGOTADA = 2, DESCONOCIDO = 3 };
+
+    struct DominioRed final : err::Dominio {
+        constexpr DominioRed() noexcept : err::Dominio("red") {};
+        std::string Mensaje(int valor) const override {
+            switch (valor) {
+                case RECHAZADA: return "Conexión rechazada";
+                case AGOTADA: return "Tiempo agotado";
+                default: return "Fallo de red";
+            }
+        };
+        bool equivalente(int propio, const err::Dominio& otro, int valor) const noexcept override {
+            if (otro != err::dominios::SISTEMA) return false;
+            return (propio == RECHAZADA && valor == ECONNREFUSED) || (propio == AGOTADA && valor == ETIMEDOUT);
+        };
+    };
+    inline constexpr DominioRed RED;
+    inline constexpr err::Descriptor CONEXION_RECHAZADA{err::ERROR, RED, RECHAZADA, "Conexión rechazada"};
+}
+
+TEST_CASE("Error con dominio y código", "[error][dominio]") {
+    using namespace dominio_prueba;
+
+    SECTION("Dominio genérico por defecto") {
+        err::Error e = err::Generico("Entrada vacía");
+        REQUIRE(e.Dominio() == err::dominios::GENERICO);
+        REQUIRE(e.Valor() == err::ERROR);
+        REQUIRE(e.equivale(err::dominios::GENERICO, err::ERROR));
+        REQUIRE(err::Fatal().Valor() == err::FATAL);
+        REQUIRE(err::dominios::GENERICO.Mensaje(err::FATAL) == "Error Fatal");
+    }
+
+    SECTION("Dominio propio") {
+        err::Error literal(err::ERROR, RED, AGOTADA, "Sin respuesta del servidor");
+        REQUIRE(literal.Dominio() == RED);
+        REQUIRE(literal.Valor() == AGOTADA);
+        REQUIRE(literal.Mensaje() == "[-1] Sin respuesta del servidor\n");
+
+        err::Error porDominio(err::FATAL, RED, RECHAZADA);
+        REQUIRE(porDominio.Mensaje() == "[-2] Conexión rechazada\n");
+        REQUIRE(porDominio);
+        REQUIRE(!err::Error(err::EXITO, RED, DESCONOCIDO));
+
+        err::ErrorEstatico estatico = CONEXION_RECHAZADA;
+        REQUIRE(estatico.Dominio() == RED);
+        REQUIRE(estatico.Categoria() == "red");
+        err::Error desdeDescriptor = estatico;
+        REQUIRE(desdeDescriptor.Valor() == RECHAZADA);
+        REQUIRE(desdeDescriptor.equivale(RED, RECHAZADA));
+        REQUIRE(!desdeDescriptor.equivale(err::dominios::GENERICO, RECHAZADA));
+    }
+
+    SECTION("Equivalencias con errno") {
+        err::Error e(err::ERROR, RED, RECHAZADA, "Conexión rechazada por 10.0.0.1");
+        REQUIRE(e.equivale(err::dominios::SISTEMA, ECONNREFUSED));
+        REQUIRE(!e.equivale(err::dominios::SISTEMA, ETIMEDOUT));
+
+        err::Error sistema = err::Sistema(ETIMEDOUT);
+        REQUIRE(sistema.Dominio() == err::dominios::SISTEMA);
+        REQUIRE(sistema.Mensaje() == "[-1] " + std::generic_category().message(ETIMEDOUT) + "\n");
+        REQUIRE(sistema.equivale(RED, AGOTADA));
+        REQUIRE(!sistema.equivale(RED, RECHAZADA));
+    }
+
+    SECTION("Las copias conservan dominio y valor") {
+        err::Error original(err::ERROR, RED, AGOTADA, std::string("Sin respuesta de 10.0.0.1"));
+        original.agregarMensaje("al consultar\n");
+        err::Error copia = original;
+        err::Error movida = std::move(copia);
+        REQUIRE(movida.Dominio() == RED);
+        REQUIRE(movida.Valor() == AGOTADA);
+        REQUIRE(err::Error(&original).equivale(err::dominios::SISTEMA, ETIMEDOUT));
+    }
+}
+
+#ifndef ERRORES_SIN_UBICACION
+namespace {
+    err::Error fallarAqui(std::uint_least32_t& linea) {
+        linea = __LINE__ + 1;
+        return err::Fatal(std::string("Disco lleno"));
+    }
+}
+#endif
+
+TEST_CASE("Error registra dónde se creó", "[error][ubicacion]") {
+#ifndef ERRORES_SIN_UBICACION
+    SECTION("Constructores y funciones utilitarias") {
+        pruebas::ContadorAsignaciones contador;
+        std::uint_least32_t linea = __LINE__ + 1;
+        err::Error literal = err::Generico("Entrada vacía");
+        REQUIRE(contador.cuenta() == 0);
+        REQUIRE(literal.Donde().line() == linea);
+        REQUIRE(std::string_view(literal.Donde().file_name()).ends_with("pruebas.cpp"));
+
+        linea = __LINE__ + 1;
+        err::Error directo(err::ERROR, dominio_prueba::RED, dominio_prueba::AGOTADA, "Sin respuesta");
+        REQUIRE(directo.Donde().line() == linea);
+
+        linea = __LINE__ + 1;
+        err::Error catalogado = err::ErrorEstatico(catalogo_prueba::DESBORDE);
+        REQUIRE(catalogado.Donde().line() == linea);
+    }
+
+    SECTION("Se conserva al copiar y al propagar") {
+        std::uint_least32_t linea = 0;
+        err::Error e = fallarAqui(linea);
+        e.agregarMensaje("al guardar\n");
+        err::Error copia = e;
+        REQUIRE(copia.Donde().line() == linea);
+        REQUIRE(std::string_view(copia.Donde().function_name()).find("fallarAqui") != std::string_view::npos);
+        REQUIRE(err::Error(&e).Donde().line() == linea);
+    }
+#else
+    STATIC_REQUIRE(std::is_empty_v<err::Ubicacion>);
+    REQUIRE(err::Generico("Entrada vacía").Donde().line() == 0);
+#endif
+}
+
+#if ERRORES_TRAZA > 0
+namespace {
+    // Cambia la política de trazas y la restaura al salir, para no afectar a las demás pruebas.
+    struct PoliticaTemporal {
+        err::traza::Politica anterior;
+        explicit PoliticaTemporal(err::traza::Politica politica) : anterior(err::traza::establecerPolitica(politica)) {}
+        ~PoliticaTemporal() { err::traza::establecerPolitica(anterior); }
+    };
+}
+
+TEST_CASE("Traza de la pila al crear errores", "[error][traza]") {
+    using err::traza::Politica;
+
+    SECTION("Nunca") {
+        PoliticaTemporal politica(Politica::NUNCA);
+        REQUIRE(err::Fatal("Disco lleno").Pila().vacia());
+        REQUIRE(err::Fatal("Disco lleno").Mensaje() == "[-2] Disco lleno\n");
+    }
+
+    SECTION("Sólo fatales") {
+        PoliticaTemporal politica(Politica::FATALES);
+        REQUIRE(!err::Fatal("Disco lleno").Pila().vacia());
+        REQUIRE(err::Generico("Entrada vacía").Pila().vacia());
+        REQUIRE(err::Exito().Pila().vacia());
+    }
+
+    SECTION("Todos") {
+        PoliticaTemporal politica(Politica::TODOS);
+        REQUIRE(!err::Generico("Entrada vacía").Pila().vacia());
+        REQUIRE(!err::Error(err::ERROR, std::string("Entrada vacía")).Pila().vacia());
+        REQUIRE(err::Exito().Pila().vacia());
+    }
+
+    SECTION("Sólo reserva memoria el error que captura marcos") {
+        PoliticaTemporal politica(Politica::FATALES);
+        err::Error primera = err::Fatal();   // la primera captura puede inicializar el desenrollador
+        pruebas::ContadorAsignaciones contador;
+        err::Error sinTraza = err::Generico("Entrada vacía");
+        REQUIRE(contador.cuenta() == 0);
+        err::Error e = err::Fatal("Disco lleno");
+        REQUIRE(contador.cuenta() == 1);
+        err::Error copia = e;
+        REQUIRE(contador.cuenta() == 1);
+        REQUIRE(e.Pila().tamano() > 0);
+        REQUIRE(e.Pila().tamano() <= ERRORES_TRAZA_PROFUNDIDAD);
+        REQUIRE(&copia.Pila() == &e.Pila());
+    }
+
+    SECTION("Se resuelve al imprimir") {
+        PoliticaTemporal politica(Politica::FATALES);
+        err::Error e = err::Fatal("Disco lleno");
+        e.agregarMensaje("al guardar\n");
+        std::string mensaje = e.Mensaje();
+        REQUIRE(mensaje.starts_with("[-2] Disco lleno\nal guardar\nTraza:\n  #0 "));
+        REQUIRE(std::count(mensaje.begin(), mensaje.end(), '\n') == static_cast<long>(3 + e.Pila().tamano()));
+
+        std::ostringstream os;
+        os << e;
+        REQUIRE(os.str() == mensaje);
+        err::Error copia = e;
+        REQUIRE(copia.Pila().tamano() == e.Pila().tamano());
+        REQUIRE(copia.Pila()[0] == e.Pila()[0]);
+    }
+
+    SECTION("Copiar y asignar llevan los marcos capturados") {
+        PoliticaTemporal politica(Politica::FATALES);
+        err::Traza capturada = err::Fatal("Disco lleno").Pila();
+        err::Traza asignada = err::Generico("Entrada vacía").Pila();
+        REQUIRE(asignada.vacia());
+        asignada = capturada;
+        REQUIRE(asignada.tamano() == capturada.tamano());
+        for (std::size_t i = 0; i < capturada.tamano(); ++i) {
+            REQUIRE(asignada[i] == capturada[i]);
+        }
+        asignada = err::Traza();
+        REQUIRE(asignada.vacia());
+    }
+}
+#endif
+
 /****************************************************************
  *                    PRUEBAS DE OPCION                         *
  ****************************************************************/
@@ -184,6 +620,78 @@ TEST_CASE("Opcion con shared_ptr", "[opcion][smart_ptr]") {
     }
 }
 
+// Tipos propios con centinela ("nicho")
+enum class DescriptorArchivo : int {};
+template<> struct opc::Centinela<DescriptorArchivo> : opc::CentinelaValor<DescriptorArchivo, DescriptorArchivo{-1}> {};
+
+struct Medicion { double valor; };
+template<> struct opc::Centinela<Medicion> {
+    static Medicion vacio() noexcept { return Medicion{std::numeric_limits<double>::quiet_NaN()}; }
+    static bool esVacio(const Medicion& m) noexcept { return std::isnan(m.valor); }
+};
+
+// NaN como centinela de un tipo fundamental. Ninguna otra prueba usa `Opcion<long double>`.
+template<> struct opc::Centinela<long double> : opc::CentinelaValor<long double, std::numeric_limits<long double>::quiet_NaN()> {};
+
+TEST_CASE("Opcion con centinela", "[opcion][centinela][memoria]") {
+    STATIC_REQUIRE(sizeof(opc::Opcion<DatosPrueba*>) == sizeof(DatosPrueba*));
+    STATIC_REQUIRE(sizeof(opc::Opcion<std::unique_ptr<DatosPrueba>>) == sizeof(std::unique_ptr<DatosPrueba>));
+    STATIC_REQUIRE(sizeof(opc::Opcion<std::shared_ptr<DatosPrueba>>) == sizeof(std::shared_ptr<DatosPrueba>));
+    STATIC_REQUIRE(sizeof(opc::Opcion<DescriptorArchivo>) == sizeof(DescriptorArchivo));
+    STATIC_REQUIRE(sizeof(opc::Opcion<Medicion>) == sizeof(Medicion));
+    STATIC_REQUIRE(!opc::con_centinela<int>);
+
+    SECTION("Puntero nulo equivale a vacío") {
+        opc::Opcion<DatosPrueba*> opcion(nullptr);
+        REQUIRE(opcion.estaVacia());
+    }
+
+    SECTION("Descriptor de archivo") {
+        opc::Opcion<DescriptorArchivo> vacia;
+        REQUIRE(vacia.estaVacia());
+        REQUIRE(vacia.valorO(DescriptorArchivo{0}) == DescriptorArchivo{0});
+
+        opc::Opcion<DescriptorArchivo> abierta(DescriptorArchivo{3});
+        auto [fd, ok] = abierta();
+        REQUIRE(ok);
+        REQUIRE(fd == DescriptorArchivo{3});
+
+        opc::Opcion<DescriptorArchivo> invalida(DescriptorArchivo{-1});
+        REQUIRE(invalida.estaVacia());
+    }
+
+    SECTION("Medición con NaN") {
+        opc::Opcion<Medicion> vacia;
+        REQUIRE(vacia.estaVacia());
+        auto [m, ok] = vacia();
+        REQUIRE(!ok);
+        REQUIRE(std::isnan(m.valor));
+
+        opc::Opcion<Medicion> medida(Medicion{1.5});
+        REQUIRE(!medida.estaVacia());
+        REQUIRE(medida.valorO(Medicion{0.0}).valor == 1.5);
+    }
+
+    SECTION("CentinelaValor con NaN") {
+        using NaN = opc::CentinelaValor<double, std::numeric_limits<double>::quiet_NaN()>;
+        REQUIRE(NaN::esVacio(NaN::vacio()));
+        // Cualquier NaN, no sólo el del centinela.
+        REQUIRE(NaN::esVacio(std::nan("1")));
+        REQUIRE(NaN::esVacio(-std::numeric_limits<double>::quiet_NaN()));
+        REQUIRE(!NaN::esVacio(0.0));
+        REQUIRE(!NaN::esVacio(std::numeric_limits<double>::infinity()));
+
+        STATIC_REQUIRE(sizeof(opc::Opcion<long double>) == sizeof(long double));
+        opc::Opcion<long double> vacia;
+        REQUIRE(vacia.estaVacia());
+        opc::Opcion<long double> calculada(std::sqrt(-1.0L));
+        REQUIRE(calculada.estaVacia());
+        opc::Opcion<long double> medida(2.5L);
+        REQUIRE(!medida.estaVacia());
+        REQUIRE(medida.valorO(0.0L) == 2.5L);
+    }
+}
+
 /****************************************************************
  *                  PRUEBAS DE RESULTADO                        *
  ****************************************************************/
@@ -271,6 +779,1427 @@ TEST_CASE("Resultado con shared_ptr", "[resultado][smart_ptr]") {
     }
 }
 
+/****************************************************************
+ *                PRUEBAS DE SEMÁNTICA DE MOVIMIENTO            *
+ ****************************************************************/
+
+TEST_CASE("Movimientos noexcept", "[opcion][resultado][movimiento]") {
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<opc::Opcion<std::string>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<opc::Opcion<DatosPrueba*>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<opc::Opcion<std::unique_ptr<DatosPrueba>>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<res::Resultado<std::string>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<res::Resultado<DatosPrueba*>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<res::Resultado<std::unique_ptr<DatosPrueba>>>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<res::Resultado<std::string>>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<res::Resultado<std::unique_ptr<DatosPrueba>>>);
+}
+
+TEST_CASE("Disposición de Opcion para tipos triviales", "[opcion][memoria]") {
+    STATIC_REQUIRE(!std::is_polymorphic_v<opc::Opcion<int>>);
+    STATIC_REQUIRE(!std::is_polymorphic_v<res::Resultado<int>>);
+
+    STATIC_REQUIRE(std::is_trivially_copyable_v<opc::Opcion<int>>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<opc::Opcion<double>>);
+    STATIC_REQUIRE(std::is_trivially_destructible_v<opc::Opcion<int>>);
+    STATIC_REQUIRE(std::is_trivially_destructible_v<opc::Opcion<double>>);
+    STATIC_REQUIRE(!std::is_trivially_copyable_v<opc::Opcion<std::string>>);
+
+    // Caben en dos registros de propósito general (ABI System V x86-64).
+    STATIC_REQUIRE(sizeof(opc::Opcion<int>) == 2 * sizeof(int));
+    STATIC_REQUIRE(sizeof(opc::Opcion<double>) <= 16);
+    STATIC_REQUIRE(sizeof(opc::Opcion<std::int64_t>) <= 16);
+}
+
+TEST_CASE("Movimiento transfiere la propiedad", "[opcion][resultado][movimiento]") {
+    SECTION("Opcion con puntero desnudo") {
+        opc::Opcion<DatosPrueba*> origen(new DatosPrueba(7));
+        opc::Opcion<DatosPrueba*> destino(std::move(origen));
+        REQUIRE(origen.estaVacia());
+        auto [ptr, existe] = destino();
+        REQUIRE(existe);
+        REQUIRE(ptr->valor == 7);
+        delete ptr;
+    }
+
+    SECTION("Resultado con unique_ptr") {
+        res::Resultado<std::unique_ptr<DatosPrueba>> origen(std::make_unique<DatosPrueba>(7));
+        res::Resultado<std::unique_ptr<DatosPrueba>> destino;
+        destino = std::move(origen);
+        REQUIRE(origen.Error() == err::catalogo::MOVIDO);
+        auto [ptr, error] = destino();
+        REQUIRE(!error);
+        REQUIRE(ptr->valor == 7);
+    }
+
+    SECTION("Vector de Resultado con puntero desnudo") {
+        std::vector<res::Resultado<DatosPrueba*>> v;
+        for (int i = 0; i < 100; ++i) {
+            v.emplace_back(new DatosPrueba(i));
+        }
+        auto [ptr, error] = v[99]();
+        REQUIRE(!error);
+        REQUIRE(ptr->valor == 99);
+        delete ptr;
+    }
+}
+
+// Disposición original de `Resultado<T>`: una base polimórfica con el error
+// (código y mensaje en un `std::string`) y, en la derivada, el valor.
+namespace anterior {
+    struct Error {
+        err::CodigoEstado codigo;
+        std::string mensaje;
+    };
+    struct ResultadoBase {
+        Error error;
+        virtual ~ResultadoBase() = default;
+    };
+}
+
+template<typename T>
+struct DisposicionAnterior : anterior::ResultadoBase {
+    T resultado;
+};
+
+// Disposición actual: unión del valor y el error más el discriminante.
+template<typename T>
+constexpr std::size_t tamanoUnion() {
+    constexpr std::size_t alineacion = std::max(alignof(T), alignof(err::Error));
+    constexpr std::size_t datos = std::max(sizeof(T), sizeof(err::Error)) + 1;
+    return (datos + alineacion - 1) / alineacion * alineacion;
+}
+
+struct Bloque256 { char datos[256]; };
+
+struct SinConstructorPorDefecto {
+    int valor;
+    explicit SinConstructorPorDefecto(int v) : valor(v) {}
+};
+
+// Copia que lanza a pedido; el movimiento es `noexcept` salvo en `SinMovimientoSeguro`.
+struct CopiaQueLanza {
+    static inline bool lanzar = false;
+    int valor;
+    explicit CopiaQueLanza(int v) : valor(v) {}
+    CopiaQueLanza(const CopiaQueLanza& o) : valor(o.valor) {
+        if (lanzar) throw std::runtime_error("copia");
+    }
+    CopiaQueLanza(CopiaQueLanza&&) noexcept = default;
+    CopiaQueLanza& operator=(const CopiaQueLanza&) = default;
+    CopiaQueLanza& operator=(CopiaQueLanza&&) noexcept = default;
+};
+
+struct SinMovimientoSeguro {
+    static inline bool lanzar = false;
+    int valor;
+    explicit SinMovimientoSeguro(int v) : valor(v) {}
+    SinMovimientoSeguro(const SinMovimientoSeguro& o) : valor(o.valor) {
+        if (lanzar) throw std::runtime_error("copia");
+    }
+    SinMovimientoSeguro(SinMovimientoSeguro&& o) : valor(o.valor) {}
+    SinMovimientoSeguro& operator=(const SinMovimientoSeguro& o) {
+        if (lanzar) throw std::runtime_error("asignación");
+        valor = o.valor;
+        return *this;
+    }
+    SinMovimientoSeguro& operator=(SinMovimientoSeguro&&) = default;
+};
+
+TEST_CASE("Resultado almacena el valor o el error", "[resultado][memoria]") {
+    STATIC_REQUIRE(sizeof(res::Resultado<int>) == tamanoUnion<int>());
+    STATIC_REQUIRE(sizeof(res::Resultado<double>) == tamanoUnion<double>());
+    STATIC_REQUIRE(sizeof(res::Resultado<std::string>) == tamanoUnion<std::string>());
+    STATIC_REQUIRE(sizeof(res::Resultado<Bloque256>) == tamanoUnion<Bloque256>());
+
+    STATIC_REQUIRE(sizeof(res::Resultado<int>) < sizeof(DisposicionAnterior<int>));
+    STATIC_REQUIRE(sizeof(res::Resultado<double>) < sizeof(DisposicionAnterior<double>));
+    STATIC_REQUIRE(sizeof(res::Resultado<std::string>) < sizeof(DisposicionAnterior<std::string>));
+    STATIC_REQUIRE(sizeof(res::Resultado<Bloque256>) < sizeof(DisposicionAnterior<Bloque256>));
+
+    SECTION("T sin constructor por defecto en el camino de error") {
+        res::Resultado<SinConstructorPorDefecto> fallido(err::Generico("sin valor"));
+        REQUIRE(!fallido);
+        auto [v, error] = fallido(SinConstructorPorDefecto(-1));
+        REQUIRE(error);
+        REQUIRE(v.valor == -1);
+
+        res::Resultado<SinConstructorPorDefecto> exitoso(SinConstructorPorDefecto(3));
+        REQUIRE(exitoso);
+        auto [w, sinError] = exitoso(SinConstructorPorDefecto(-1));
+        REQUIRE(!sinError);
+        REQUIRE(w.valor == 3);
+    }
+
+    SECTION("Un error descarta el valor") {
+        res::Resultado<std::string> r(std::string(100, 'x'), err::Generico());
+        REQUIRE(!r);
+        auto [texto, error] = r();
+        REQUIRE(error);
+        REQUIRE(texto.empty());
+    }
+
+    SECTION("Copia y asignación entre estados") {
+        res::Resultado<std::string> a(std::string("valor"));
+        res::Resultado<std::string> b(err::Generico());
+        b = a;
+        REQUIRE(b);
+        REQUIRE(std::get<0>(b()) == "valor");
+        a = res::Resultado<std::string>(err::Fatal());
+        REQUIRE(!a);
+        REQUIRE(a.Error().Codigo() == err::FATAL);
+    }
+
+    SECTION("Una copia que lanza no altera el destino") {
+        res::Resultado<CopiaQueLanza> valor(CopiaQueLanza(7));
+        res::Resultado<CopiaQueLanza> fallido(err::Fatal("previo"));
+        res::Resultado<CopiaQueLanza> otroValor(CopiaQueLanza(1));
+        CopiaQueLanza::lanzar = true;
+        REQUIRE_THROWS_AS(fallido = valor, std::runtime_error);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error().Codigo() == err::FATAL);
+        REQUIRE_THROWS_AS(otroValor = valor, std::runtime_error);
+        REQUIRE(otroValor);
+        REQUIRE(otroValor.Valor().valor == 1);
+        CopiaQueLanza::lanzar = false;
+        fallido = valor;
+        REQUIRE(fallido);
+        REQUIRE(fallido.Valor().valor == 7);
+    }
+
+    SECTION("Sin movimiento noexcept se restaura el error previo") {
+        res::Resultado<SinMovimientoSeguro> valor(SinMovimientoSeguro(7));
+        res::Resultado<SinMovimientoSeguro> fallido(err::Fatal("previo"));
+        SinMovimientoSeguro::lanzar = true;
+        REQUIRE_THROWS_AS(fallido = valor, std::runtime_error);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error().Codigo() == err::FATAL);
+        SinMovimientoSeguro::lanzar = false;
+        fallido = valor;
+        REQUIRE(fallido);
+        REQUIRE(fallido.Valor().valor == 7);
+    }
+}
+
+enum class CodigoParseo : int { OK = 0, VACIO, INVALIDO };
+
+TEST_CASE("Resultado con error propio", "[resultado][error_propio]") {
+    // Un par valor/enumeración cabe en dos registros.
+    STATIC_REQUIRE(sizeof(res::Resultado<int, CodigoParseo>) == 8);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<res::Resultado<int, CodigoParseo>>);
+    STATIC_REQUIRE(res::error_inequivoco<int, CodigoParseo>);
+    STATIC_REQUIRE(!res::error_inequivoco<long, int>);
+    // `err::Error` se convierte en `bool`, pero nunca se toma como valor.
+    STATIC_REQUIRE(res::error_inequivoco<int, err::Error>);
+    STATIC_REQUIRE(res::error_inequivoco<std::string, err::Error>);
+
+    SECTION("Enumeración como error") {
+        res::Resultado<int, CodigoParseo> fallido(CodigoParseo::INVALIDO);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error() == CodigoParseo::INVALIDO);
+        res::Resultado<int, CodigoParseo> etiquetado(res::en_error, CodigoParseo::VACIO);
+        REQUIRE(!etiquetado);
+        REQUIRE(etiquetado.Error() == CodigoParseo::VACIO);
+        res::Resultado<int, CodigoParseo> exitoso(4);
+        REQUIRE(exitoso);
+        REQUIRE(exitoso.Error() == CodigoParseo::OK);
+    }
+
+    SECTION("Consumir un fallo sin estado movido no lo vuelve éxito") {
+        res::Resultado<int, CodigoParseo> fallido(res::en_error, CodigoParseo::VACIO);
+        auto [v, error] = std::move(fallido).Consumir();
+        REQUIRE(v == 0);
+        REQUIRE(error == CodigoParseo::VACIO);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error() == CodigoParseo::VACIO);
+
+        res::Resultado<int, CodigoParseo> exitoso(4);
+        auto [w, sinError] = std::move(exitoso).Consumir();
+        REQUIRE(w == 4);
+        REQUIRE(sinError == CodigoParseo::OK);
+        REQUIRE(exitoso);
+        REQUIRE(exitoso.Valor() == 0);
+    }
+
+    SECTION("Valor y error del mismo tipo") {
+        STATIC_REQUIRE(!res::error_inequivoco<int, int>);
+        res::Resultado<int, int> exitoso(5);
+        REQUIRE(exitoso);
+        REQUIRE(std::get<0>(exitoso()) == 5);
+        res::Resultado<int, int> fallido(res::en_error, 5);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error() == 5);
+    }
+
+    SECTION("Valor y error convertibles entre sí") {
+        // Sin etiqueta, el argumento es siempre el valor.
+        res::Resultado<long, int> exitoso(5);
+        REQUIRE(exitoso);
+        REQUIRE(std::get<0>(exitoso()) == 5L);
+        res::Resultado<long, int> fallido(res::en_error, 5);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error() == 5);
+
+        res::Resultado<int, long> alReves(5);
+        REQUIRE(alReves);
+        REQUIRE(std::get<0>(alReves()) == 5);
+    }
+
+    SECTION("Los combinadores respetan la etiqueta") {
+        auto mitad = [](int x) {
+            return x % 2 == 0 ? res::Resultado<int, int>(x / 2) : res::Resultado<int, int>(res::en_error, x);
+        };
+        auto par = res::Resultado<int, int>(8).yLuego(mitad).mapear([](int x) { return x + 1; });
+        REQUIRE(par);
+        REQUIRE(std::get<0>(par()) == 5);
+        auto impar = res::Resultado<int, int>(3).yLuego(mitad).mapear([](int x) { return x + 1; });
+        REQUIRE(!impar);
+        REQUIRE(impar.Error() == 3);
+        auto negado = std::move(impar).transformarError([](int e) { return -e; });
+        REQUIRE(!negado);
+        REQUIRE(negado.Error() == -3);
+    }
+
+    SECTION("ResultadoLote reconstruye fallos con la etiqueta") {
+        res::ResultadoLote<int, int> lote;
+        lote.agregar(res::Resultado<int, int>(1));
+        lote.agregar(res::Resultado<int, int>(res::en_error, 7));
+        REQUIRE(lote[0]);
+        REQUIRE(!lote[1]);
+        REQUIRE(lote[1].Error() == 7);
+        auto resultados = lote.aResultados();
+        REQUIRE(resultados[0]);
+        REQUIRE(!resultados[1]);
+        REQUIRE(resultados[1].Error() == 7);
+    }
+}
+
+// Cuenta copias y movimientos para verificar la construcción en su lugar.
+struct Contado {
+    static inline int copias = 0;
+    static inline int movimientos = 0;
+    int a, b;
+    Contado(int a, int b) : a(a), b(b) {}
+    Contado(const Contado& o) : a(o.a), b(o.b) { ++copias; }
+    Contado(Contado&& o) noexcept : a(o.a), b(o.b) { ++movimientos; }
+};
+
+struct NoMovible {
+    int valor;
+    explicit NoMovible(int v) : valor(v) {}
+    NoMovible(const NoMovible&) = delete;
+    NoMovible(NoMovible&&) = delete;
+};
+
+enum class CodigoLectura : int { OK = 0, AGOTADO };
+
+// Constructor que lanza a pedido.
+struct ConstruccionQueLanza {
+    int valor = 0;
+    ConstruccionQueLanza() noexcept = default;
+    ConstruccionQueLanza(int v, bool lanzar) : valor(v) {
+        if (lanzar) throw std::runtime_error("construcción");
+    }
+};
+
+// Sin constructor por defecto ni movimiento: no hay otro valor que dejar si la construcción lanza.
+struct SinDefectoQueLanza {
+    static inline int vivos = 0;
+    int valor;
+    SinDefectoQueLanza(int v, bool lanzar) : valor(v) {
+        if (lanzar) throw std::runtime_error("construcción");
+        ++vivos;
+    }
+    SinDefectoQueLanza(const SinDefectoQueLanza&) = delete;
+    SinDefectoQueLanza(SinDefectoQueLanza&&) = delete;
+    ~SinDefectoQueLanza() { --vivos; }
+};
+
+// Constructor por defecto `noexcept`, pero movimiento que puede lanzar.
+struct MovimientoQueLanza {
+    int valor = 0;
+    MovimientoQueLanza() noexcept = default;
+    MovimientoQueLanza(int v, bool lanzar) : valor(v) {
+        if (lanzar) throw std::runtime_error("construcción");
+    }
+    MovimientoQueLanza(MovimientoQueLanza&& o) : valor(o.valor) {}
+    MovimientoQueLanza& operator=(MovimientoQueLanza&&) = default;
+};
+
+TEST_CASE("Construcción en su lugar", "[opcion][resultado][emplace]") {
+    SECTION("Sin copias ni movimientos") {
+        Contado::copias = Contado::movimientos = 0;
+        opc::Opcion<Contado> o(std::in_place, 1, 2);
+        res::Resultado<Contado> r(std::in_place, 3, 4);
+        o.emplace(5, 6);
+        r.emplace(7, 8);
+        REQUIRE(Contado::copias == 0);
+        REQUIRE(Contado::movimientos == 0);
+        REQUIRE(!o.estaVacia());
+        REQUIRE(o.valorO(Contado(0, 0)).a == 5);
+        REQUIRE(r);
+    }
+
+    SECTION("Tipos no movibles") {
+        opc::Opcion<NoMovible> o(std::in_place, 1);
+        REQUIRE(!o.estaVacia());
+        REQUIRE(o.emplace(2).valor == 2);
+
+        res::Resultado<NoMovible> r(err::Generico());
+        REQUIRE(!r);
+        REQUIRE(r.emplace(3).valor == 3);
+        REQUIRE(r);
+    }
+
+    SECTION("emplace reemplaza un error") {
+        res::Resultado<std::string> r(err::Generico());
+        r.emplace(3, 'x');
+        REQUIRE(r);
+        REQUIRE(std::get<0>(r()) == "xxx");
+    }
+
+    SECTION("emplace es noexcept sólo si la construcción lo es") {
+        STATIC_REQUIRE(noexcept(std::declval<opc::Opcion<int>&>().emplace(1)));
+        STATIC_REQUIRE(noexcept(std::declval<res::Resultado<int>&>().emplace(1)));
+        STATIC_REQUIRE(!noexcept(std::declval<opc::Opcion<ConstruccionQueLanza>&>().emplace(1, true)));
+        STATIC_REQUIRE(!noexcept(std::declval<res::Resultado<ConstruccionQueLanza>&>().emplace(1, true)));
+    }
+
+    SECTION("Si emplace lanza, el estado sigue siendo válido") {
+        opc::Opcion<ConstruccionQueLanza> o(std::in_place, 1, false);
+        REQUIRE_THROWS_AS(o.emplace(2, true), std::runtime_error);
+        REQUIRE(o.estaVacia());
+        REQUIRE(o.emplace(3, false).valor == 3);
+        REQUIRE(!o.estaVacia());
+
+        res::Resultado<ConstruccionQueLanza> fallido(err::Fatal("previo"));
+        REQUIRE_THROWS_AS(fallido.emplace(2, true), std::runtime_error);
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error().Codigo() == err::FATAL);
+
+        res::Resultado<ConstruccionQueLanza> exitoso(std::in_place, 1, false);
+        REQUIRE_THROWS_AS(exitoso.emplace(2, true), std::runtime_error);
+        REQUIRE(!exitoso);
+        REQUIRE(exitoso.Error() == err::catalogo::MOVIDO);
+
+        // Sin `RasgosError<E>::movido()`, recupera el valor anterior.
+        res::Resultado<ConstruccionQueLanza, CodigoLectura> conValor(std::in_place, 1, false);
+        REQUIRE_THROWS_AS(conValor.emplace(2, true), std::runtime_error);
+        REQUIRE(conValor);
+        REQUIRE(conValor.Valor().valor == 1);
+    }
+
+    SECTION("Sin estado vacío propio, emplace lanza sin terminar") {
+        SinDefectoQueLanza::vivos = 0;
+        {
+            opc::Opcion<SinDefectoQueLanza> o(std::in_place, 1, false);
+            REQUIRE(SinDefectoQueLanza::vivos == 1);
+            REQUIRE_THROWS_AS(o.emplace(2, true), std::runtime_error);
+            REQUIRE(o.estaVacia());
+            REQUIRE(SinDefectoQueLanza::vivos == 0);
+            REQUIRE(o.emplace(3, false).valor == 3);
+            REQUIRE(SinDefectoQueLanza::vivos == 1);
+        }
+        REQUIRE(SinDefectoQueLanza::vivos == 0);
+
+        // Sin `movido()` ni movimiento seguro: queda un valor inicializado a cero.
+        res::Resultado<MovimientoQueLanza, CodigoLectura> aCero(std::in_place, 1, false);
+        REQUIRE_THROWS_AS(aCero.emplace(2, true), std::runtime_error);
+        REQUIRE(aCero);
+        REQUIRE(aCero.Valor().valor == 0);
+
+        // Ni eso: el valor nuevo se construye aparte y el anterior sigue en pie.
+        res::Resultado<SinMovimientoSeguro, CodigoLectura> aparte(std::in_place, 1);
+        SinMovimientoSeguro fuente(2);
+        SinMovimientoSeguro::lanzar = true;
+        REQUIRE_THROWS_AS(aparte.emplace(fuente), std::runtime_error);
+        SinMovimientoSeguro::lanzar = false;
+        REQUIRE(aparte);
+        REQUIRE(aparte.Valor().valor == 1);
+        REQUIRE(aparte.emplace(fuente).valor == 2);
+    }
+
+    SECTION("noexcept según las operaciones de T y E") {
+        STATIC_REQUIRE(noexcept(std::declval<opc::Opcion<int>&>().Consumir()));
+        STATIC_REQUIRE(!noexcept(std::declval<opc::Opcion<CopiaQueLanza>&>().Consumir(std::declval<CopiaQueLanza>())));
+        STATIC_REQUIRE(std::is_nothrow_constructible_v<res::Resultado<int, CodigoLectura>, int, CodigoLectura>);
+        STATIC_REQUIRE(!std::is_nothrow_constructible_v<res::Resultado<MovimientoQueLanza, CodigoLectura>,
+                                                        MovimientoQueLanza, CodigoLectura>);
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<res::Resultado<std::string>>);
+        STATIC_REQUIRE(!std::is_nothrow_move_constructible_v<res::Resultado<MovimientoQueLanza, CodigoLectura>>);
+    }
+}
+
+TEST_CASE("Consumir mueve el valor", "[opcion][resultado][movimiento]") {
+    SECTION("Consumir sobre lvalue copia y conserva el valor") {
+        Contado::copias = Contado::movimientos = 0;
+        res::Resultado<Contado> r(std::in_place, 1, 2);
+        auto [valor, error] = r.Consumir(Contado(0, 0));
+        REQUIRE(Contado::copias == 1);
+        REQUIRE(!error);
+        REQUIRE(valor.a == 1);
+        REQUIRE(r);
+    }
+
+    SECTION("Consumir sobre rvalue mueve sin copiar") {
+        Contado::copias = Contado::movimientos = 0;
+        res::Resultado<Contado> r(std::in_place, 1, 2);
+        auto [valor, error] = std::move(r).Consumir(Contado(0, 0));
+        REQUIRE(Contado::copias == 0);
+        REQUIRE(!error);
+        REQUIRE(valor.b == 2);
+        REQUIRE(r.Error() == err::catalogo::MOVIDO);
+
+        opc::Opcion<Contado> o(std::in_place, 3, 4);
+        auto [otro, ok] = std::move(o)(Contado(0, 0));
+        REQUIRE(Contado::copias == 0);
+        REQUIRE(ok);
+        REQUIRE(otro.a == 3);
+        REQUIRE(o.estaVacia());
+    }
+
+    SECTION("Extraer deja la opción vacía") {
+        opc::Opcion<std::string> o(std::string(100, 'x'));
+        auto [texto, ok] = o.Extraer();
+        REQUIRE(ok);
+        REQUIRE(texto.size() == 100);
+        REQUIRE(o.estaVacia());
+        REQUIRE(!std::get<1>(o.Extraer()));
+
+        opc::Opcion<DescriptorArchivo> abierta(DescriptorArchivo{3});
+        REQUIRE(std::get<0>(abierta.Extraer()) == DescriptorArchivo{3});
+        REQUIRE(abierta.estaVacia());
+    }
+
+    SECTION("Tipos sólo movibles") {
+        opc::Opcion<std::vector<std::unique_ptr<int>>> o(std::in_place);
+        o.emplace().push_back(std::make_unique<int>(5));
+        auto [lista, ok] = o.Extraer();
+        REQUIRE(ok);
+        REQUIRE(*lista[0] == 5);
+
+        res::Resultado<std::vector<std::unique_ptr<int>>, CodigoLectura> r(std::in_place);
+        auto [vacia, codigo] = std::move(r)();
+        REQUIRE(vacia.empty());
+        REQUIRE(codigo == CodigoLectura::OK);
+    }
+
+    SECTION("Extraer un error lo mueve fuera") {
+        res::Resultado<std::string> r(err::Generico("sin datos"));
+        auto [texto, error] = r.Extraer();
+        REQUIRE(texto.empty());
+        REQUIRE(error.Mensaje() == "[-1] sin datos\n");
+        REQUIRE(r.Error() == err::catalogo::MOVIDO);
+    }
+}
+
+TEST_CASE("Acceso prestado sin consumir", "[opcion][resultado][acceso]") {
+    SECTION("Valores directos") {
+        opc::Opcion<std::string> o(std::string("hola"));
+        REQUIRE(o.Valor() == "hola");
+        o.Valor() += "!";
+        REQUIRE(*o.si() == "hola!");
+        REQUIRE(opc::Opcion<std::string>().si() == nullptr);
+
+        res::Resultado<std::vector<int>> r(std::vector<int>{1, 2, 3});
+        const auto& cr = r;
+        REQUIRE(cr.Valor().size() == 3);
+        REQUIRE(r.si() == &r.Valor());
+        REQUIRE(!cr.Error());
+        REQUIRE(std::move(r).Valor().size() == 3);
+    }
+
+    SECTION("Error por referencia, sin copias") {
+        res::Resultado<int> r(err::Generico(std::string(64, 'x')));
+        pruebas::ContadorAsignaciones contador;
+        const err::Error& error = r.Error();
+        REQUIRE(error);
+        REQUIRE(&error == &r.Error());
+        REQUIRE(r.si() == nullptr);
+        REQUIRE(contador.cuenta() == 0);
+
+        res::Resultado<int> exitoso(1);
+        REQUIRE(!exitoso.Error());
+        const res::Resultado<int> otro(2);
+        REQUIRE(&exitoso.Error() == &otro.Error());
+    }
+
+    SECTION("Punteros: préstamo sin ceder la propiedad") {
+        opc::Opcion<std::unique_ptr<DatosPrueba>> o(std::make_unique<DatosPrueba>(7));
+        REQUIRE(o.si()->valor == 7);
+        REQUIRE(!o.estaVacia());
+
+        res::Resultado<DatosPrueba*> r(new DatosPrueba(8));
+        REQUIRE(r.si()->valor == 8);
+        REQUIRE(r);
+    }
+}
+
+TEST_CASE("Combinadores", "[opcion][resultado][combinadores]") {
+    SECTION("Opcion") {
+        opc::Opcion<int> tres(3);
+        auto doble = tres.mapear([](int v) { return v * 2.0; });
+        STATIC_REQUIRE(std::is_same_v<decltype(doble), opc::Opcion<double>>);
+        REQUIRE(doble.Valor() == 6.0);
+
+        auto mitad = [](int v) { return v % 2 == 0 ? opc::Opcion<int>(v / 2) : opc::Opcion<int>(); };
+        REQUIRE(tres.yLuego(mitad).estaVacia());
+        REQUIRE(opc::Opcion<int>(8).yLuego(mitad).yLuego(mitad).Valor() == 2);
+        REQUIRE(opc::Opcion<int>().mapear([](int v) { return v + 1; }).estaVacia());
+
+        REQUIRE(tres.yLuego(mitad).oSino([] { return opc::Opcion<int>(-1); }).Valor() == -1);
+        REQUIRE(tres.oSino([] { return opc::Opcion<int>(-1); }).Valor() == 3);
+    }
+
+    SECTION("Resultado") {
+        res::Resultado<int> cinco(5);
+        auto texto = cinco.mapear([](int v) { return std::to_string(v); });
+        STATIC_REQUIRE(std::is_same_v<decltype(texto), res::Resultado<std::string>>);
+        REQUIRE(texto.Valor() == "5");
+
+        auto fallido = cinco.yLuego([](int) { return res::Resultado<int>(err::Generico("sin divisor")); })
+                            .mapear([](int v) { return v + 1; });
+        REQUIRE(!fallido);
+        REQUIRE(fallido.Error().Mensaje() == "[-1] sin divisor\n");
+
+        auto recuperado = std::move(fallido).oSino([](const err::Error&) { return res::Resultado<int>(0); });
+        REQUIRE(recuperado.Valor() == 0);
+
+        auto codigo = res::Resultado<int>(err::Fatal()).transformarError([](const err::Error& e) { return e.Codigo(); });
+        STATIC_REQUIRE(std::is_same_v<decltype(codigo), res::Resultado<int, err::CodigoEstado>>);
+        REQUIRE(codigo.Error() == err::CodigoEstado::FATAL);
+    }
+
+    SECTION("Sobre temporales mueven el valor") {
+        Contado::copias = Contado::movimientos = 0;
+        auto r = res::Resultado<Contado>(std::in_place, 1, 2)
+            .mapear([](Contado&& c) { return std::move(c); })
+            .yLuego([](Contado&& c) { return res::Resultado<Contado>(std::move(c)); });
+        REQUIRE(r.Valor().a == 1);
+        REQUIRE(Contado::copias == 0);
+
+        auto cantidad = opc::Opcion<std::vector<std::unique_ptr<int>>>(std::in_place)
+            .mapear([](std::vector<std::unique_ptr<int>>&& v) { return v.size(); });
+        REQUIRE(cantidad.Valor() == 0);
+    }
+
+    SECTION("Cadena equivalente a la cascada de if") {
+        for (int x = -5; x < 2'100'000; x += 997) {
+            auto a = validacion::encadenado(x);
+            auto b = validacion::cascada(x);
+            REQUIRE(static_cast<bool>(a) == static_cast<bool>(b));
+            REQUIRE(a.Error() == b.Error());
+            if (a) REQUIRE(a.Valor() == b.Valor());
+
+            auto c = validacion::generico::encadenado(x);
+            auto d = validacion::generico::cascada(x);
+            REQUIRE(static_cast<bool>(c) == static_cast<bool>(a));
+            REQUIRE(c.Error().Mensaje() == d.Error().Mensaje());
+            if (c) REQUIRE(c.Valor() == a.Valor());
+        }
+    }
+}
+
+res::Resultado<int> leerEntero(int x) {
+    if (x < 0) return res::Resultado<int>(err::Generico("negativo"));
+    return res::Resultado<int>(x);
+}
+res::Resultado<int> incrementar(int x) {
+    int v = co_await leerEntero(x);
+    co_return v + 1;
+}
+res::Resultado<std::string> formatear(int x) {
+    int v = co_await incrementar(x);
+    co_return std::to_string(v);
+}
+opc::Opcion<int> mitadExacta(int x) {
+    if (x % 2 != 0) return opc::Opcion<int>();
+    return opc::Opcion<int>(x / 2);
+}
+opc::Opcion<int> cuartoExacto(int x) {
+    int v = co_await mitadExacta(x);
+    co_return co_await mitadExacta(v);
+}
+res::Resultado<std::unique_ptr<DatosPrueba>> envolver(int x) {
+    int v = co_await leerEntero(x);
+    co_return std::make_unique<DatosPrueba>(v);
+}
+res::Resultado<int> lanzarSiNegativo(int x) {
+    int v = co_await leerEntero(x + 1);
+    if (x < 0) throw std::runtime_error("negativo");
+    co_return v;
+}
+
+// Error liviano que cuenta sus copias.
+struct ErrorContado {
+    static inline int copias = 0;
+    int codigo = 0;
+    ErrorContado() = default;
+    explicit ErrorContado(int codigo) : codigo(codigo) {}
+    ErrorContado(const ErrorContado& o) : codigo(o.codigo) { ++copias; }
+    ErrorContado(ErrorContado&&) noexcept = default;
+    ErrorContado& operator=(const ErrorContado&) = default;
+    ErrorContado& operator=(ErrorContado&&) noexcept = default;
+    explicit operator bool() const noexcept { return codigo != 0; }
+};
+
+res::Resultado<int, ErrorContado> fallarContado() {
+    return res::Resultado<int, ErrorContado>(ErrorContado(3));
+}
+res::Resultado<int, ErrorContado> propagarContado() {
+    int v = co_await fallarContado();
+    co_return v;
+}
+
+TEST_CASE("Corrutinas", "[opcion][resultado][corrutinas]") {
+    SECTION("co_await entrega el valor") {
+        auto r = formatear(41);
+        REQUIRE(r);
+        REQUIRE(r.Valor() == "42");
+        REQUIRE(cuartoExacto(12).Valor() == 3);
+    }
+
+    SECTION("co_await propaga el error a través de las capas") {
+        auto r = formatear(-1);
+        REQUIRE(!r);
+        REQUIRE(r.Error().Mensaje() == "[-1] negativo\n");
+        REQUIRE(cuartoExacto(6).estaVacia());
+        REQUIRE(cuartoExacto(3).estaVacia());
+    }
+
+    SECTION("Punteros y lvalues") {
+        auto r = envolver(5);
+        REQUIRE(r.si()->valor == 5);
+        REQUIRE(!envolver(-5));
+
+        auto fuente = res::Resultado<int>(7);
+        auto copia = [&]() -> res::Resultado<int> { int v = co_await fuente; co_return v; }();
+        REQUIRE(copia.Valor() == 7);
+        REQUIRE(fuente.Valor() == 7);
+    }
+
+    SECTION("Los marcos no pasan por el heap") {
+        formatear(1);
+        pruebas::ContadorAsignaciones contador;
+        auto r = formatear(-1);
+        REQUIRE(!r);
+        REQUIRE(contador.cuenta() == 0);
+    }
+
+    SECTION("Una excepción se relanza con el marco ya liberado") {
+        REQUIRE(lanzarSiNegativo(1).Valor() == 2);
+        // Cada marco perdido agotaría la pila del hilo y el siguiente iría al heap.
+        for (int i = 0; i < 5000; ++i) {
+            REQUIRE_THROWS_AS(lanzarSiNegativo(-1), std::runtime_error);
+        }
+        pruebas::ContadorAsignaciones contador;
+        auto r = formatear(1);
+        REQUIRE(r.Valor() == "2");
+        REQUIRE(contador.cuenta() == 0);
+    }
+
+    SECTION("co_await sobre un temporal mueve el error") {
+        ErrorContado::copias = 0;
+        auto r = propagarContado();
+        REQUIRE(!r);
+        REQUIRE(r.Error().codigo == 3);
+        REQUIRE(ErrorContado::copias == 0);
+    }
+}
+
+// Ejecutor que acumula las tareas hasta que se lo vacía.
+struct EjecutorDiferido {
+    std::vector<res::Tarea> tareas;
+    void ejecutar(res::Tarea tarea) { tareas.push_back(std::move(tarea)); }
+    void vaciar() {
+        while (!tareas.empty()) {
+            auto pendientes = std::move(tareas);
+            tareas.clear();
+            for (auto& tarea : pendientes) tarea();
+        }
+    }
+};
+
+// Un error asíncrono sin `fatal(mensaje)`.
+enum class CodigoEtapa : int { OK = 0, CANCELADA, ABANDONADA };
+
+template<>
+struct res::RasgosError<CodigoEtapa> {
+    static constexpr CodigoEtapa exito() noexcept { return CodigoEtapa::OK; };
+    static constexpr bool esError(CodigoEtapa c) noexcept { return c != CodigoEtapa::OK; };
+    static constexpr CodigoEtapa cancelado() noexcept { return CodigoEtapa::CANCELADA; };
+    static constexpr CodigoEtapa abandonado() noexcept { return CodigoEtapa::ABANDONADA; };
+};
+
+TEST_CASE("ResultadoAsync", "[resultado][asincronia]") {
+    SECTION("Se completa desde otro hilo") {
+        res::PromesaAsync<int> promesa;
+        auto resultado = promesa.obtenerResultado();
+        std::thread productor([p = std::move(promesa)]() mutable { p.cumplir(42); });
+        auto r = std::move(resultado).esperar();
+        productor.join();
+        REQUIRE(r.Valor() == 42);
+    }
+
+    SECTION("luego encadena y aplana") {
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado()
+            .luego([](int v) { return v * 2; })
+            .luego([](int v) { return res::Resultado<std::string>(std::to_string(v)); })
+            .luego([](std::string s) { return res::ResultadoAsync<std::size_t>(res::Resultado<std::size_t>(s.size())); });
+        REQUIRE(!final.listo());
+        promesa.cumplir(50);
+        REQUIRE(final.listo());
+        REQUIRE(std::move(final).esperar().Valor() == 3);
+    }
+
+    SECTION("Un error saltea las etapas") {
+        int llamadas = 0;
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado()
+            .luego([&](int v) { ++llamadas; return v; })
+            .luego([&](int v) { ++llamadas; return v; });
+        promesa.fallar(err::Generico("sin conexión"));
+        auto r = std::move(final).esperar();
+        REQUIRE(llamadas == 0);
+        REQUIRE(r.Error().Mensaje() == "[-1] sin conexión\n");
+    }
+
+    SECTION("Continuaciones en un ejecutor") {
+        EjecutorDiferido ejecutor;
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado().luego([](int v) { return v + 1; }, ejecutor);
+        promesa.cumplir(1);
+        REQUIRE(!final.listo());
+        REQUIRE(ejecutor.tareas.size() == 1);
+        ejecutor.vaciar();
+        REQUIRE(std::move(final).esperar().Valor() == 2);
+    }
+
+    SECTION("Una excepción en luego completa la etapa siguiente con FATAL") {
+        int llamadas = 0;
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado()
+            .luego([](int v) -> int { if (v > 0) throw std::runtime_error("desborde"); return v; })
+            .luego([&](int v) { ++llamadas; return v; });
+        REQUIRE(promesa.cumplir(1));
+        auto r = std::move(final).esperar();
+        REQUIRE(llamadas == 0);
+        REQUIRE(r.Error().Codigo() == err::FATAL);
+        REQUIRE(r.Error().Mensaje() == "[-2] desborde\n");
+
+        // También cuando la función devuelve otro `ResultadoAsync` y cuando lo lanzado no es una `std::exception`.
+        res::PromesaAsync<int> otra;
+        auto anidado = otra.obtenerResultado()
+            .luego([](int) -> res::ResultadoAsync<int> { throw 7; });
+        REQUIRE(otra.cumplir(1));
+        REQUIRE(std::move(anidado).esperar().Error().Codigo() == err::FATAL);
+
+        // Sin `fatal(mensaje)`, la etapa queda abandonada.
+        res::PromesaAsync<int, CodigoEtapa> propia;
+        auto abandonada = propia.obtenerResultado()
+            .luego([](int) -> int { throw std::logic_error("sin fatal"); });
+        REQUIRE(propia.cumplir(1));
+        REQUIRE(std::move(abandonada).esperar().Error() == CodigoEtapa::ABANDONADA);
+    }
+
+    SECTION("Cancelación y promesa abandonada") {
+        res::PromesaAsync<int> promesa;
+        auto resultado = promesa.obtenerResultado();
+        resultado.cancelar();
+        REQUIRE(promesa.cancelada());
+        REQUIRE(!promesa.cumplir(1));
+        REQUIRE(std::move(resultado).esperar().Error() == err::catalogo::CANCELADO);
+
+        auto abandonado = res::PromesaAsync<int>().obtenerResultado();
+        REQUIRE(std::move(abandonado).esperar().Error() == err::catalogo::ABANDONADO);
+    }
+
+    SECTION("Cancelar el final de una cadena llega al productor") {
+        res::PromesaAsync<int> promesa;
+        bool ejecutada = false;
+        auto final = promesa.obtenerResultado()
+            .luego([&](int v) { ejecutada = true; return v + 1; });
+        REQUIRE(!promesa.cancelada());
+        final.cancelar();
+        REQUIRE(promesa.cancelada());
+        REQUIRE(!promesa.cumplir(1));
+        REQUIRE(!ejecutada);
+        REQUIRE(std::move(final).esperar().Error() == err::catalogo::CANCELADO);
+    }
+
+    SECTION("Un ResultadoAsync movido no está listo y cancelarlo no hace nada") {
+        res::ResultadoAsync<int> origen(res::Resultado<int>(1));
+        auto destino = std::move(origen);
+        REQUIRE(!origen.listo());
+        origen.cancelar();
+        REQUIRE(destino.listo());
+        REQUIRE(std::move(destino).esperar().Valor() == 1);
+    }
+
+    SECTION("cuandoTodos y cuandoCualquiera") {
+        std::vector<res::PromesaAsync<int>> promesas(4);
+        std::vector<res::ResultadoAsync<int>> resultados;
+        for (auto& p : promesas) resultados.push_back(p.obtenerResultado());
+        auto todos = res::cuandoTodos(std::move(resultados));
+
+        std::vector<std::thread> hilos;
+        for (int i = 3; i >= 0; --i) {
+            hilos.emplace_back([p = std::move(promesas[i]), i]() mutable { p.cumplir(i * 10); });
+        }
+        auto r = std::move(todos).esperar();
+        for (auto& h : hilos) h.join();
+        REQUIRE(r.Valor() == std::vector<int>{0, 10, 20, 30});
+
+        std::vector<res::PromesaAsync<int>> otras(3);
+        std::vector<res::ResultadoAsync<int>> entradas;
+        for (auto& p : otras) entradas.push_back(p.obtenerResultado());
+        auto primero = res::cuandoCualquiera(std::move(entradas));
+        otras[1].fallar(err::Fatal());
+        otras[0].cumplir(5);
+        REQUIRE(std::move(primero).esperar().Error().Codigo() == err::FATAL);
+
+        std::vector<res::PromesaAsync<int>> conError(2);
+        std::vector<res::ResultadoAsync<int>> parciales;
+        for (auto& p : conError) parciales.push_back(p.obtenerResultado());
+        auto fallido = res::cuandoTodos(std::move(parciales));
+        conError[0].cumplir(1);
+        conError[1].fallar(err::Generico());
+        REQUIRE(!std::move(fallido).esperar());
+    }
+}
+
+enum class CodigoTarea : int { OK = 0, FALLIDA, CANCELADA, ABANDONADA, EXCEPCION };
+
+template<>
+struct res::RasgosError<CodigoTarea> {
+    static constexpr CodigoTarea exito() noexcept { return CodigoTarea::OK; };
+    static constexpr bool esError(CodigoTarea c) noexcept { return c != CodigoTarea::OK; };
+    static constexpr CodigoTarea cancelado() noexcept { return CodigoTarea::CANCELADA; };
+    static constexpr CodigoTarea abandonado() noexcept { return CodigoTarea::ABANDONADA; };
+    static constexpr bool esFatal(CodigoTarea c) noexcept { return c == CodigoTarea::EXCEPCION; };
+    static constexpr CodigoTarea fatal(std::string_view) noexcept { return CodigoTarea::EXCEPCION; };
+};
+
+TEST_CASE("GrupoHilos y LoteTareas", "[resultado][hilos]") {
+    res::GrupoHilos grupo(4);
+
+    SECTION("Recolecta valores y errores en orden") {
+        res::LoteTareas<int> lote(grupo);
+        for (int i = 0; i < 100; ++i) {
+            lote.lanzar([i]() {
+                if (i % 10 == 3) return res::Resultado<int>(err::Generico("múltiplo de diez más tres"));
+                return res::Resultado<int>(i * i);
+            });
+        }
+        auto resumen = lote.esperar();
+        REQUIRE(resumen.resultados.size() == 100);
+        REQUIRE(resumen.errores.size() == 10);
+        REQUIRE(resumen.errores[0] == 3);
+        REQUIRE(!resumen.fatal);
+        REQUIRE(resumen.canceladas == 0);
+        REQUIRE(resumen.resultados[9].Valor() == 81);
+    }
+
+    SECTION("El primer FATAL cancela el resto") {
+        res::GrupoHilos uno(1);
+        res::LoteTareas<int> lote(uno);
+        std::atomic<int> ejecutadas{0};
+        lote.lanzar([&]() { ++ejecutadas; return res::Resultado<int>(err::Fatal("disco lleno")); });
+        for (int i = 0; i < 50; ++i) {
+            lote.lanzar([&](const res::TokenCancelacion& token) {
+                ++ejecutadas;
+                return token.cancelado() ? res::Resultado<int>(err::Generico("interrumpida")) : res::Resultado<int>(1);
+            });
+        }
+        auto resumen = lote.esperar();
+        REQUIRE(resumen.fatal == 0u);
+        REQUIRE(resumen.resultados[0].Error().Mensaje() == "[-2] disco lleno\n");
+        // Con un solo hilo las tareas corren en orden: todas las posteriores se cancelan.
+        REQUIRE(ejecutadas == 1);
+        REQUIRE(resumen.canceladas == 50);
+    }
+
+    SECTION("Sólo cuenta como cancelada la tarea que no llegó a correr") {
+        res::LoteTareas<int> lote(grupo);
+        // La tarea corre y devuelve `CANCELADO` por su cuenta: es un error más.
+        lote.lanzar([]() { return res::Resultado<int>(err::Error(err::catalogo::CANCELADO)); });
+        auto resumen = lote.esperar();
+        REQUIRE(resumen.canceladas == 0);
+        REQUIRE(resumen.errores == std::vector<std::size_t>{0});
+    }
+
+    SECTION("Una excepción no detiene al hilo ni a ayudar") {
+        res::GrupoHilos uno(1);
+        std::atomic<bool> ocupado{false}, soltar{false};
+        uno.ejecutar(res::Tarea([&]() { ocupado = true; ocupado.notify_one(); soltar.wait(false); }));
+        ocupado.wait(false);
+        uno.ejecutar(res::Tarea([]() { throw std::runtime_error("suelta"); }));
+        // El único hilo está ocupado: la tarea que lanza corre acá.
+        REQUIRE(uno.ayudar());
+        soltar = true;
+        soltar.notify_one();
+
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado()
+            .luego([](int) -> int { throw std::runtime_error("en el grupo"); }, uno);
+        uno.ejecutar(res::Tarea([]() { throw 1; }));
+        promesa.cumplir(1);
+        REQUIRE(std::move(final).esperar().Error().Mensaje() == "[-2] en el grupo\n");
+
+        res::LoteTareas<int> lote(uno);
+        lote.lanzar([]() { return res::Resultado<int>(1); });
+        REQUIRE(lote.esperar().resultados[0].Valor() == 1);
+    }
+
+    SECTION("Con ErrorEstatico") {
+        res::GrupoHilos uno(1);
+        res::LoteTareas<int, err::ErrorEstatico> lote(uno);
+        lote.lanzar([]() { return res::Resultado<int, err::ErrorEstatico>(err::catalogo::ERROR); });
+        lote.lanzar([]() -> res::Resultado<int, err::ErrorEstatico> { throw std::runtime_error("inesperado"); });
+        lote.lanzar([]() { return res::Resultado<int, err::ErrorEstatico>(3); });
+        auto resumen = lote.esperar();
+        REQUIRE(resumen.errores == std::vector<std::size_t>{0});
+        REQUIRE(resumen.fatal == 1u);
+        REQUIRE(resumen.resultados[1].Error() == err::catalogo::FATAL);
+        REQUIRE(resumen.canceladas == 1);
+        REQUIRE(resumen.resultados[2].Error() == err::catalogo::CANCELADO);
+    }
+
+    SECTION("Con un error propio") {
+        res::GrupoHilos uno(1);
+        res::LoteTareas<int, CodigoTarea> lote(uno);
+        lote.lanzar([]() { return res::Resultado<int, CodigoTarea>(CodigoTarea::FALLIDA); });
+        lote.lanzar([]() { return res::Resultado<int, CodigoTarea>(7); });
+        lote.lanzar([]() -> res::Resultado<int, CodigoTarea> { throw 1; });
+        lote.lanzar([]() { return res::Resultado<int, CodigoTarea>(8); });
+        auto resumen = lote.esperar();
+        REQUIRE(resumen.errores == std::vector<std::size_t>{0});
+        REQUIRE(resumen.resultados[1].Valor() == 7);
+        REQUIRE(resumen.fatal == 2u);
+        REQUIRE(resumen.resultados[2].Error() == CodigoTarea::EXCEPCION);
+        REQUIRE(resumen.canceladas == 1);
+        REQUIRE(resumen.resultados[3].Error() == CodigoTarea::CANCELADA);
+    }
+
+    SECTION("Una excepción se trata como FATAL") {
+        res::LoteTareas<int> lote(grupo);
+        lote.lanzar([]() -> res::Resultado<int> { throw std::runtime_error("inesperado"); });
+        auto resumen = lote.esperar();
+        REQUIRE(resumen.fatal == 0u);
+        REQUIRE(resumen.resultados[0].Error().Codigo() == err::FATAL);
+    }
+
+    SECTION("Sirve de ejecutor para ResultadoAsync") {
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado().luego([](int v) { return v + 1; }, grupo);
+        promesa.cumplir(1);
+        REQUIRE(std::move(final).esperar().Valor() == 2);
+    }
+
+    SECTION("Tareas anidadas esperan sin bloquear el grupo") {
+        res::GrupoHilos dos(2);
+        res::LoteTareas<int> externo(dos);
+        for (int i = 0; i < 4; ++i) {
+            externo.lanzar([&dos]() {
+                res::LoteTareas<int> interno(dos);
+                for (int j = 0; j < 8; ++j) interno.lanzar([j]() { return res::Resultado<int>(j); });
+                auto resumen = interno.esperar();
+                int suma = 0;
+                for (auto& r : resumen.resultados) suma += r.Valor();
+                return res::Resultado<int>(suma);
+            });
+        }
+        auto resumen = externo.esperar();
+        for (auto& r : resumen.resultados) REQUIRE(r.Valor() == 28);
+    }
+}
+
+TEST_CASE("OpcionLote", "[opcion][lote]") {
+    // 130 elementos: dos palabras completas del mapa y una parcial.
+    opc::OpcionLote<double> lote;
+    for (int i = 0; i < 130; ++i) {
+        if (i % 3 == 0) lote.agregar(i * 0.5);
+        else lote.agregarVacia();
+    }
+
+    SECTION("Acceso por elemento") {
+        REQUIRE(lote.tamano() == 130);
+        REQUIRE(lote.presente(3));
+        REQUIRE_FALSE(lote.presente(4));
+        REQUIRE(lote[3].Valor() == 1.5);
+        REQUIRE(lote[4].estaVacia());
+        auto modificado = lote;
+        modificado.asignar(4, 9.0);
+        modificado.vaciar(3);
+        REQUIRE(modificado[4].Valor() == 9.0);
+        REQUIRE(modificado[3].estaVacia());
+        REQUIRE(modificado.contarPresentes() == lote.contarPresentes());
+    }
+
+    SECTION("Operaciones masivas") {
+        REQUIRE(lote.contarPresentes() == 44);
+
+        auto completos = lote.valorO(-1.0);
+        REQUIRE(completos.size() == 130);
+        REQUIRE(completos[0] == 0.0);
+        REQUIRE(completos[1] == -1.0);
+        REQUIRE(completos[129] == 64.5);
+
+        auto compactos = lote.compactar();
+        REQUIRE(compactos.size() == 44);
+        REQUIRE(compactos[1] == 1.5);
+
+        std::vector<std::size_t> indices;
+        lote.paraCadaPresente([&](std::size_t i, double v) { indices.push_back(i); REQUIRE(v == i * 0.5); });
+        REQUIRE(indices.size() == 44);
+        REQUIRE(indices.back() == 129);
+    }
+
+    SECTION("Conversión desde y hacia Opcion") {
+        auto opciones = lote.aOpciones();
+        REQUIRE(opciones.size() == 130);
+        REQUIRE(opciones[6].Valor() == 3.0);
+        REQUIRE(opciones[7].estaVacia());
+        opc::OpcionLote<double> copia(opciones);
+        REQUIRE(copia.contarPresentes() == lote.contarPresentes());
+        REQUIRE(copia.compactar() == lote.compactar());
+    }
+
+    SECTION("Lote de vacías") {
+        opc::OpcionLote<int> vacias(100);
+        REQUIRE(vacias.contarPresentes() == 0);
+        REQUIRE(vacias.valorO(7) == std::vector<int>(100, 7));
+    }
+}
+
+TEST_CASE("ResultadoLote", "[resultado][lote]") {
+    // Un error cada 50 elementos, en 130 elementos.
+    auto producir = [](int desde, int hasta) {
+        res::ResultadoLote<int> lote;
+        for (int i = desde; i < hasta; ++i) {
+            if (i % 50 == 7) lote.agregarError(err::Generico("inválido " + std::to_string(i)));
+            else lote.agregar(i);
+        }
+        return lote;
+    };
+    auto lote = producir(0, 130);
+
+    SECTION("Acceso por elemento") {
+        REQUIRE(lote.tamano() == 130);
+        REQUIRE(lote.exito(6));
+        REQUIRE_FALSE(lote.exito(7));
+        REQUIRE(lote.error(6) == nullptr);
+        REQUIRE(lote.error(57)->Mensaje() == "[-1] inválido 57\n");
+        REQUIRE(lote[6].Valor() == 6);
+        REQUIRE(lote[107].Error().Mensaje() == "[-1] inválido 107\n");
+    }
+
+    SECTION("Recorrer sólo los fallos o sólo los éxitos") {
+        REQUIRE(lote.contarErrores() == 3);
+        REQUIRE(lote.contarExitos() == 127);
+        std::vector<std::size_t> fallidos;
+        lote.paraCadaFallo([&](std::size_t i, const err::Error&) { fallidos.push_back(i); });
+        REQUIRE(fallidos == std::vector<std::size_t>{7, 57, 107});
+        long suma = 0;
+        lote.paraCadaExito([&](std::size_t, int v) { suma += v; });
+        REQUIRE(suma == 129 * 130 / 2 - 7 - 57 - 107);
+    }
+
+    SECTION("Anexar lotes de varios productores") {
+        // Cortes que no caen en múltiplos de 64, para probar el corrimiento del mapa.
+        auto unido = producir(0, 37);
+        unido.anexar(producir(37, 100));
+        unido.anexar(producir(100, 130));
+        REQUIRE(unido.tamano() == 130);
+        REQUIRE(unido.errores().size() == 3);
+        REQUIRE(unido.errores()[1].first == 57);
+        REQUIRE(unido.mapa().datos() == lote.mapa().datos());
+        REQUIRE(unido.datos() == lote.datos());
+    }
+
+    SECTION("Conversión desde y hacia std::vector<Resultado>") {
+        auto resultados = lote.aResultados();
+        REQUIRE(resultados.size() == 130);
+        REQUIRE(resultados[8].Valor() == 8);
+        REQUIRE(!resultados[57]);
+        res::ResultadoLote<int> deVuelta(std::move(resultados));
+        REQUIRE(deVuelta.datos() == lote.datos());
+        REQUIRE(deVuelta.error(107)->Mensaje() == lote.error(107)->Mensaje());
+
+        auto movidos = std::move(deVuelta).aResultados();
+        REQUIRE(movidos[129].Valor() == 129);
+        REQUIRE(deVuelta.tamano() == 0);
+    }
+}
+
+// Compara cada nivel vectorial con la versión escalar, con un mapa pseudoaleatorio
+// que incluye palabras llenas y vacías y una cola que no completa una palabra.
+template<typename T>
+void verificarNucleos() {
+    constexpr std::size_t N = 64 * 20 + 37;
+    std::vector<T> datos(N);
+    for (std::size_t i = 0; i < N; ++i) datos[i] = static_cast<T>(i + 1);
+    std::vector<std::uint64_t> mapa((N + 63) / 64);
+    std::uint64_t estado = 0x9E3779B97F4A7C15u;
+    for (auto& palabra : mapa) {
+        estado ^= estado << 13; estado ^= estado >> 7; estado ^= estado << 17;
+        palabra = estado;
+    }
+    mapa[2] = ~std::uint64_t{0};
+    mapa[3] = 0;
+    mapa.back() &= (std::uint64_t{1} << (N % 64)) - 1;
+
+    std::vector<T> compactoEscalar(N), rellenoEscalar(datos);
+    std::size_t presentes = simd::compactar(simd::Nivel::ESCALAR, datos.data(), mapa.data(), N, compactoEscalar.data());
+    simd::rellenar(simd::Nivel::ESCALAR, rellenoEscalar.data(), mapa.data(), N, T(-1));
+    REQUIRE(presentes == simd::contarBits(simd::Nivel::ESCALAR, mapa.data(), mapa.size()));
+    REQUIRE(compactoEscalar[0] == T(1));
+    REQUIRE(rellenoEscalar[3 * 64] == T(-1));
+
+    for (auto nivel : {simd::Nivel::SSE2, simd::Nivel::AVX2}) {
+        std::vector<T> compacto(N), relleno(datos);
+        REQUIRE(simd::contarBits(nivel, mapa.data(), mapa.size()) == presentes);
+        REQUIRE(simd::compactar(nivel, datos.data(), mapa.data(), N, compacto.data()) == presentes);
+        REQUIRE(std::equal(compacto.begin(), compacto.begin() + presentes, compactoEscalar.begin()));
+        simd::rellenar(nivel, relleno.data(), mapa.data(), N, T(-1));
+        REQUIRE(relleno == rellenoEscalar);
+    }
+}
+
+TEST_CASE("Núcleos vectoriales sobre mapas de bits", "[simd][lote]") {
+    SECTION("Cada nivel coincide con el escalar") {
+        verificarNucleos<std::int32_t>();
+        verificarNucleos<std::int64_t>();
+        verificarNucleos<float>();
+        verificarNucleos<double>();
+    }
+
+    SECTION("Intersección de mapas de varias columnas") {
+        opc::MapaBits a(200, true), b(200), c(200, true);
+        for (std::size_t i = 0; i < 200; i += 3) b.poner(i);
+        c.quitar(99);
+        auto validas = opc::MapaBits::interseccion(a, b, c);
+        REQUIRE(validas.tamano() == 200);
+        REQUIRE(validas.contar() == 66);
+        REQUIRE(validas.leer(198));
+        REQUIRE_FALSE(validas.leer(99));
+        for (auto nivel : {simd::Nivel::ESCALAR, simd::Nivel::SSE2, simd::Nivel::AVX2}) {
+            std::vector<std::uint64_t> destino(b.datos().size());
+            const std::uint64_t* mapas[] = {a.datos().data(), b.datos().data(), c.datos().data()};
+            simd::combinarMapas(nivel, destino.data(), mapas, 3, destino.size());
+            REQUIRE(destino == validas.datos());
+        }
+    }
+}
+
+struct Instantanea {
+    static inline std::atomic<int> vivas{0};
+    int version;
+    explicit Instantanea(int v) : version(v) { ++vivas; }
+    ~Instantanea() { --vivas; }
+};
+
+TEST_CASE("OpcionAtomica", "[opcion][punteros][hilos]") {
+    SECTION("Publicar, tomar y liberar sobrantes") {
+        {
+            opc::OpcionAtomica<Instantanea*> ranura;
+            REQUIRE(ranura.estaVacia());
+            REQUIRE(ranura.publicar(new Instantanea(1)).estaVacia());
+            auto anterior = ranura.publicar(new Instantanea(2));
+            REQUIRE(anterior.si()->version == 1);
+            auto tomada = ranura.tomar();
+            REQUIRE(tomada.si()->version == 2);
+            REQUIRE(ranura.tomar().estaVacia());
+            ranura.publicar(new Instantanea(3));
+        }
+        // El valor reemplazado, el tomado y el que quedó en la ranura se liberaron.
+        REQUIRE(Instantanea::vivas == 0);
+    }
+
+    SECTION("compararYPublicar intercambia la propiedad sólo si coincide") {
+        opc::OpcionAtomica<Instantanea*> ranura;
+        Instantanea* esperado = nullptr;
+        opc::Opcion<Instantanea*> nueva(new Instantanea(1));
+        REQUIRE(ranura.compararYPublicar(esperado, nueva));
+        REQUIRE(nueva.estaVacia());
+
+        opc::Opcion<Instantanea*> otra(new Instantanea(2));
+        esperado = nullptr;
+        REQUIRE_FALSE(ranura.compararYPublicar(esperado, otra));
+        REQUIRE(esperado->version == 1);
+        REQUIRE(otra.si()->version == 2);
+
+        REQUIRE(ranura.compararYPublicar(esperado, otra));
+        REQUIRE(otra.si()->version == 1);
+        REQUIRE(ranura.tomar().si()->version == 2);
+    }
+    REQUIRE(Instantanea::vivas == 0);
+
+    SECTION("Entrega entre hilos sin pérdidas ni dobles liberaciones") {
+        constexpr int PUBLICADAS = 20'000;
+        std::atomic<int> tomadas{0};
+        std::atomic<bool> fin{false};
+        bool enOrden = true;
+        {
+            opc::OpcionAtomica<Instantanea*> ranura;
+            std::thread productor([&] {
+                for (int i = 1; i <= PUBLICADAS; ++i) {
+                    // Una versión reemplazada sin tomar se libera acá mismo.
+                    ranura.publicar(new Instantanea(i));
+                }
+                fin = true;
+            });
+            std::thread consumidor([&] {
+                int ultima = 0;
+                while (!fin || !ranura.estaVacia()) {
+                    if (auto tomada = ranura.tomar()) {
+                        // Catch2 no admite aserciones desde otros hilos: se verifica al final.
+                        enOrden = enOrden && tomada.si()->version > ultima;
+                        ultima = tomada.si()->version;
+                        ++tomadas;
+                    }
+                }
+            });
+            productor.join();
+            consumidor.join();
+        }
+        REQUIRE(enOrden);
+        REQUIRE(tomadas > 0);
+        REQUIRE(Instantanea::vivas == 0);
+    }
+}
+
+struct SinDefecto {
+    int valor;
+    explicit SinDefecto(int v) : valor(v) {}
+};
+
+struct CopiaRechazada {
+    int valor;
+};
+
+// Lanza al copiarse si su valor es negativo: una excepción que no deriva de `std::exception`.
+struct CopiaEnTramo {
+    int valor;
+    explicit CopiaEnTramo(int v) : valor(v) {}
+    CopiaEnTramo(const CopiaEnTramo& otra) : valor(otra.valor) {
+        if (valor < 0) throw CopiaRechazada{valor};
+    }
+    CopiaEnTramo(CopiaEnTramo&&) noexcept = default;
+};
+
+TEST_CASE("Recolectar y particionar", "[resultado][hilos]") {
+    // Suficientes elementos para que el modo paralelo reparta en varios tramos.
+    constexpr int N = 200'000;
+    auto generar = [](int conErrorCada) {
+        std::vector<res::Resultado<std::string>> resultados;
+        resultados.reserve(N);
+        for (int i = 0; i < N; ++i) {
+            if (conErrorCada != 0 && i % conErrorCada == conErrorCada - 1) {
+                resultados.emplace_back(err::Generico("falla " + std::to_string(i)));
+            } else {
+                resultados.emplace_back(std::to_string(i));
+            }
+        }
+        return resultados;
+    };
+    res::GrupoHilos grupo(4);
+
+    SECTION("recolectar: todos los valores, en orden") {
+        auto resultados = generar(0);
+        auto copiado = res::recolectar(resultados);
+        REQUIRE(copiado);
+        REQUIRE(copiado.Valor().size() == N);
+        REQUIRE(resultados[7].Valor() == "7");
+
+        auto paralelo = res::recolectar(std::move(resultados), grupo);
+        REQUIRE(paralelo);
+        REQUIRE(paralelo.Valor() == copiado.Valor());
+    }
+
+    SECTION("recolectar: el primer error, también en paralelo") {
+        auto resultados = generar(150'001);
+        auto secuencial = res::recolectar(resultados);
+        auto paralelo = res::recolectar(generar(150'001), grupo);
+        REQUIRE(!secuencial);
+        REQUIRE(!paralelo);
+        REQUIRE(secuencial.Error().Mensaje() == "[-1] falla 150000\n");
+        REQUIRE(paralelo.Error().Mensaje() == secuencial.Error().Mensaje());
+    }
+
+    SECTION("recolectar: tipos sin constructor por defecto") {
+        std::vector<res::Resultado<SinDefecto>> resultados;
+        for (int i = 0; i < N; ++i) resultados.emplace_back(SinDefecto(i));
+        auto paralelo = res::recolectar(std::move(resultados), grupo);
+        REQUIRE(paralelo);
+        REQUIRE(paralelo.Valor().size() == N);
+        REQUIRE(paralelo.Valor()[N - 1].valor == N - 1);
+    }
+
+    SECTION("recolectar: la excepción de un tramo se relanza con su tipo") {
+        std::vector<res::Resultado<CopiaEnTramo>> resultados;
+        for (int i = 0; i < N; ++i) resultados.emplace_back(CopiaEnTramo(i == N - 1 ? -7 : i));
+        int rechazado = 0;
+        try {
+            auto copiado = res::recolectar(resultados, grupo);
+        } catch (const CopiaRechazada& e) {
+            rechazado = e.valor;
+        }
+        REQUIRE(rechazado == -7);
+    }
+
+    SECTION("particionar: valores y errores en orden, idéntico en paralelo") {
+        auto secuencial = res::particionar(generar(1000));
+        auto paralelo = res::particionar(generar(1000), grupo);
+        REQUIRE(secuencial.valores.size() == N - N / 1000);
+        REQUIRE(secuencial.errores.size() == N / 1000);
+        REQUIRE(secuencial.errores[0].Mensaje() == "[-1] falla 999\n");
+        REQUIRE(paralelo.valores == secuencial.valores);
+        REQUIRE(paralelo.errores.size() == secuencial.errores.size());
+        REQUIRE(paralelo.errores.back().Mensaje() == secuencial.errores.back().Mensaje());
+    }
+
+    SECTION("Entradas pequeñas no se reparten") {
+        std::vector<res::Resultado<int>> pocos;
+        pocos.emplace_back(1);
+        pocos.emplace_back(2);
+        auto recolectados = res::recolectar(std::move(pocos), grupo);
+        REQUIRE(recolectados.Valor() == std::vector<int>{1, 2});
+    }
+}
+
+template<typename T>
+void imprimirFilaTamano(const char* nombre) {
+    std::cout << std::left << std::setw(22) << nombre
+              << std::right << std::setw(10) << sizeof(DisposicionAnterior<T>)
+              << std::setw(10) << sizeof(res::Resultado<T>) << '\n';
+}
+
+TEST_CASE("Tabla de tamaños de Resultado", "[.][resultado][memoria][tabla]") {
+    std::cout << std::left << std::setw(22) << "T"
+              << std::right << std::setw(10) << "anterior" << std::setw(10) << "actual" << '\n';
+    imprimirFilaTamano<int>("int");
+    imprimirFilaTamano<double>("double");
+    imprimirFilaTamano<std::string>("std::string");
+    imprimirFilaTamano<std::vector<int>>("std::vector<int>");
+    imprimirFilaTamano<Bloque256>("Bloque256");
+}
+
+TEST_CASE("Resultado consumido sin asignaciones", "[resultado][memoria]") {
+    auto datos = std::make_unique<DatosPrueba>(42);
+    res::Resultado<std::unique_ptr<DatosPrueba>> resultado(std::move(datos));
+
+    pruebas::ContadorAsignaciones contador;
+    auto [ptr, error] = resultado.Consumir();
+    REQUIRE(contador.cuenta() == 0);
+
+    REQUIRE(!error);
+    REQUIRE(ptr->valor == 42);
+    REQUIRE(resultado.Error());
+    REQUIRE(resultado.Error() == err::catalogo::MOVIDO);
+    REQUIRE(resultado.Error().Mensaje() == "[-1] Resultado movido.\n");
+}
+
 int main(int argc, char* argv[]) {
     Catch::Session session; 
     int codigo = session.applyCommandLine(argc, argv);
@@ -0,0 +1,737 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "asignaciones.hpp"
+#include "errores--.hpp"
+#include "cadena_validacion.hpp"
+
+/****************************************************************
+ *                   PRUEBAS DE RENDIMIENTO                     *
+ * ------------------------------------------------------------ *
+ *   Mediciones (Catch2 BENCHMARK) de los caminos críticos de   *
+ *   las abstracciones. Se ejecutan con:                        *
+ *       correr_rendimiento "[rendimiento]"                     *
+ ***************************************************************/
+
+/****************************************************************
+ *                         ERROR                                *
+ ****************************************************************/
+
+TEST_CASE("Error: construir, verificar y descartar", "[rendimiento][error]") {
+    SECTION("Sin asignaciones para mensajes literales") {
+        pruebas::ContadorAsignaciones contador;
+        for (int i = 0; i < 1000; ++i) {
+            err::Error e = err::Generico("Solicitud rechazada por exceder el límite de tasa");
+            if (!e) { FAIL("Se esperaba un error"); }
+        }
+        REQUIRE(contador.cuenta() == 0);
+    }
+
+    BENCHMARK("Error literal") {
+        err::Error e(err::ERROR, "Solicitud rechazada por exceder el límite de tasa");
+        return static_cast<bool>(e);
+    };
+
+    BENCHMARK("Error dinámico") {
+        err::Error e(err::ERROR, std::string("Solicitud rechazada por exceder el límite de tasa"));
+        return static_cast<bool>(e);
+    };
+
+    BENCHMARK("Error desde descriptor estático") {
+        err::Error e = err::Generico();
+        return static_cast<bool>(e);
+    };
+
+    BENCHMARK("Error literal + Mensaje()") {
+        err::Error e(err::ERROR, "Solicitud rechazada por exceder el límite de tasa");
+        return e.Mensaje().size();
+    };
+}
+
+namespace catalogo_rendimiento {
+    inline constexpr err::Descriptor LIMITE{err::ERROR, "red", "Solicitud rechazada por exceder el límite de tasa"};
+}
+
+TEST_CASE("Error: catálogo estático", "[rendimiento][error][catalogo]") {
+    SECTION("Sin asignaciones") {
+        pruebas::ContadorAsignaciones contador;
+        for (int i = 0; i < 1000; ++i) {
+            err::ErrorEstatico e = catalogo_rendimiento::LIMITE;
+            err::Error general = e;
+            if (!(general == catalogo_rendimiento::LIMITE)) { FAIL("Se esperaba identidad"); }
+            err::Error g = err::Generico();
+            err::Error f = err::Fatal();
+            if (!g || !f) { FAIL("Se esperaba un error"); }
+        }
+        REQUIRE(contador.cuenta() == 0);
+    }
+
+    BENCHMARK("ErrorEstatico: construir y comparar") {
+        err::ErrorEstatico e = catalogo_rendimiento::LIMITE;
+        return e == catalogo_rendimiento::LIMITE;
+    };
+
+    BENCHMARK("Error dinámico: construir y comparar mensaje") {
+        err::Error e(err::ERROR, std::string("Solicitud rechazada por exceder el límite de tasa"));
+        return e.Mensaje() == "[-1] Solicitud rechazada por exceder el límite de tasa\n";
+    };
+}
+
+namespace {
+    constexpr int CAPAS_CONTEXTO = 32;
+
+    // El esquema anterior: el contexto acumulado en una cadena que se copia con el error.
+    struct ErrorConTexto {
+        std::string mensaje;
+        std::string contexto;
+    };
+
+    ErrorConTexto propagarTexto(ErrorConTexto e, int capa) {
+        if (capa == CAPAS_CONTEXTO) return e;
+        e.contexto.append("en la capa " + std::to_string(capa) + "\n");
+        ErrorConTexto copia = e;   // cada capa devuelve el error por valor
+        return propagarTexto(copia, capa + 1);
+    }
+
+    err::Error propagarMarcos(err::Error e, int capa) {
+        if (capa == CAPAS_CONTEXTO) return e;
+        e.agregarMensaje("en la capa " + std::to_string(capa) + "\n");
+        err::Error copia = e;
+        return propagarMarcos(copia, capa + 1);
+    }
+}
+
+TEST_CASE("Error: contexto agregado en 32 capas", "[rendimiento][error][contexto]") {
+    BENCHMARK("Cadena acumulada, copiada en cada capa") {
+        return propagarTexto(ErrorConTexto{"sin conexión", ""}, 0).contexto.size();
+    };
+    BENCHMARK("Marcos compartidos, O(1) por capa") {
+        return propagarMarcos(err::Error(err::ERROR, std::string("sin conexión")), 0).Contexto().size();
+    };
+    BENCHMARK("Marcos compartidos + Mensaje()") {
+        return propagarMarcos(err::Error(err::ERROR, std::string("sin conexión")), 0).Mensaje().size();
+    };
+}
+
+namespace {
+    constexpr int TANDAS = 32;
+    constexpr int ERRORES_POR_TANDA = 256;
+
+    // Un hilo produce tandas de copias de `original`; otro las recibe, copia cada
+    // error una vez más (como `Resultado::Error()`, que devuelve por valor) y las descarta.
+    template<typename E, typename Medir>
+    std::size_t pasarEntreHilos(const E& original, Medir medir) {
+        std::mutex cerrojo;
+        std::condition_variable aviso;
+        std::vector<std::vector<E>> pendientes;
+        std::size_t recibido = 0;
+        std::thread consumidor([&] {
+            for (int t = 0; t < TANDAS; ++t) {
+                std::vector<E> tanda;
+                {
+                    std::unique_lock bloqueo(cerrojo);
+                    aviso.wait(bloqueo, [&] { return !pendientes.empty(); });
+                    tanda = std::move(pendientes.back());
+                    pendientes.pop_back();
+                }
+                for (const E& e : tanda) {
+                    E copia = e;
+                    recibido += medir(copia);
+                }
+            }
+        });
+        for (int t = 0; t < TANDAS; ++t) {
+            std::vector<E> tanda(ERRORES_POR_TANDA, original);
+            {
+                std::lock_guard bloqueo(cerrojo);
+                pendientes.push_back(std::move(tanda));
+            }
+            aviso.notify_one();
+        }
+        consumidor.join();
+        return recibido;
+    }
+
+    // Dos hilos copian y descartan el mismo error a la vez: contención sobre el contador.
+    template<typename E>
+    int copiarEnParalelo(const E& original) {
+        std::atomic<int> copias{0};
+        auto copiar = [&] {
+            int propias = 0;
+            for (int i = 0; i < TANDAS * ERRORES_POR_TANDA / 2; ++i) {
+                E copia = original;
+                propias += static_cast<int>(sizeof(copia));
+            }
+            copias += propias;
+        };
+        std::thread otro(copiar);
+        copiar();
+        otro.join();
+        return copias;
+    }
+}
+
+TEST_CASE("Error: copias que pasan entre hilos", "[rendimiento][error][carga][hilos]") {
+    const std::string mensaje = "sin conexión con el servidor de configuración";
+    const std::string contexto = "al abrir el socket\nal cargar la configuración\n";
+    ErrorConTexto conCadenas{mensaje, contexto};
+    err::Error conCarga(err::ERROR, mensaje);
+    conCarga.agregarMensaje("al abrir el socket\n");
+    conCarga.agregarMensaje("al cargar la configuración\n");
+
+    BENCHMARK_ADVANCED("Productor y consumidor, cadenas copiadas")(Catch::Benchmark::Chronometer medidor) {
+        medidor.measure([&](int) {
+            return pasarEntreHilos(conCadenas, [](const ErrorConTexto& e) { return e.mensaje.size(); });
+        });
+    };
+    BENCHMARK_ADVANCED("Productor y consumidor, carga compartida")(Catch::Benchmark::Chronometer medidor) {
+        medidor.measure([&](int) {
+            return pasarEntreHilos(conCarga, [](const err::Error& e) { return static_cast<std::size_t>(-e.Codigo()); });
+        });
+    };
+    BENCHMARK_ADVANCED("Copias concurrentes, cadenas copiadas")(Catch::Benchmark::Chronometer medidor) {
+        medidor.measure([&](int) { return copiarEnParalelo(conCadenas); });
+    };
+    BENCHMARK_ADVANCED("Copias concurrentes, carga compartida")(Catch::Benchmark::Chronometer medidor) {
+        medidor.measure([&](int) { return copiarEnParalelo(conCarga); });
+    };
+}
+
+TEST_CASE("Error: decidir si reintentar, 1024 errores", "[rendimiento][error][dominio]") {
+    std::vector<err::Error> errores;
+    for (int i = 0; i < 1024; ++i) {
+        switch (i % 4) {
+            case 0: errores.push_back(err::Sistema(ETIMEDOUT)); break;
+            case 1: errores.push_back(err::Sistema(ECONNREFUSED)); break;
+            case 2: errores.push_back(err::Sistema(ENOENT)); break;
+            default: errores.push_back(err::Generico("Entrada vacía")); break;
+        }
+    }
+    const std::string agotado = std::generic_category().message(ETIMEDOUT);
+    const std::string rechazado = std::generic_category().message(ECONNREFUSED);
+
+    BENCHMARK("Buscando en Mensaje()") {
+        int reintentos = 0;
+        for (const err::Error& e : errores) {
+            std::string m = e.Mensaje();
+            reintentos += m.find(agotado) != std::string::npos || m.find(rechazado) != std::string::npos;
+        }
+        return reintentos;
+    };
+    BENCHMARK("Por dominio y valor") {
+        int reintentos = 0;
+        for (const err::Error& e : errores) {
+            reintentos += e.equivale(err::dominios::SISTEMA, ETIMEDOUT) || e.equivale(err::dominios::SISTEMA, ECONNREFUSED);
+        }
+        return reintentos;
+    };
+}
+
+/****************************************************************
+ *                  CONTENEDORES Y MOVIMIENTOS                  *
+ ****************************************************************/
+
+namespace {
+    struct Carga { int valor; explicit Carga(int v) : valor(v) {} };
+
+    // Llena un vector sin reservar para forzar las reubicaciones.
+    template<typename C, typename F>
+    std::size_t llenar(std::size_t n, F crear) {
+        std::vector<C> v;
+        for (std::size_t i = 0; i < n; ++i) {
+            v.emplace_back(crear(i));
+        }
+        return v.size();
+    }
+}
+
+TEST_CASE("Vectores que crecen", "[rendimiento][movimiento]") {
+    constexpr std::size_t N = 10'000;
+    const std::string texto(64, 'x');
+
+    BENCHMARK("Opcion<std::string>") {
+        return llenar<opc::Opcion<std::string>>(N, [&](std::size_t) { return opc::Opcion<std::string>(texto); });
+    };
+    BENCHMARK("Opcion<Carga*>") {
+        return llenar<opc::Opcion<Carga*>>(N, [](std::size_t i) { return opc::Opcion<Carga*>(new Carga(int(i))); });
+    };
+    BENCHMARK("Opcion<std::unique_ptr<Carga>>") {
+        return llenar<opc::Opcion<std::unique_ptr<Carga>>>(N, [](std::size_t i) {
+            return opc::Opcion<std::unique_ptr<Carga>>(std::make_unique<Carga>(int(i)));
+        });
+    };
+    BENCHMARK("Resultado<std::string>") {
+        return llenar<res::Resultado<std::string>>(N, [&](std::size_t) { return res::Resultado<std::string>(texto); });
+    };
+    BENCHMARK("Resultado<Carga*>") {
+        return llenar<res::Resultado<Carga*>>(N, [](std::size_t i) { return res::Resultado<Carga*>(new Carga(int(i))); });
+    };
+    BENCHMARK("Resultado<std::unique_ptr<Carga>>") {
+        return llenar<res::Resultado<std::unique_ptr<Carga>>>(N, [](std::size_t i) {
+            return res::Resultado<std::unique_ptr<Carga>>(std::make_unique<Carga>(int(i)));
+        });
+    };
+}
+
+/****************************************************************
+ *                 CONSTRUCCIÓN EN SU LUGAR                     *
+ ****************************************************************/
+
+namespace {
+    struct Bloque256 {
+        unsigned char datos[256];
+        explicit Bloque256(unsigned char relleno) { std::memset(datos, relleno, sizeof(datos)); }
+    };
+}
+
+TEST_CASE("Agregados grandes: copia vs. construcción en su lugar", "[rendimiento][emplace]") {
+    BENCHMARK("Opcion<Bloque256>(Bloque256{...})") {
+        opc::Opcion<Bloque256> o(Bloque256(7));
+        return o.estaVacia();
+    };
+    BENCHMARK("Opcion<Bloque256>(std::in_place, ...)") {
+        opc::Opcion<Bloque256> o(std::in_place, 7);
+        return o.estaVacia();
+    };
+    BENCHMARK("Resultado<Bloque256>(Bloque256{...})") {
+        res::Resultado<Bloque256> r(Bloque256(7));
+        return static_cast<bool>(r);
+    };
+    BENCHMARK("Resultado<Bloque256>(std::in_place, ...)") {
+        res::Resultado<Bloque256> r(std::in_place, 7);
+        return static_cast<bool>(r);
+    };
+    BENCHMARK("Resultado<Bloque256>::emplace") {
+        res::Resultado<Bloque256> r(res::en_error, err::Generico());
+        return r.emplace(7).datos[0];
+    };
+}
+
+/****************************************************************
+ *                 CONSUMIR: COPIA VS. MOVIMIENTO               *
+ ****************************************************************/
+
+TEST_CASE("Consumir cargas grandes", "[rendimiento][movimiento][consumir]") {
+    const std::vector<char> carga(1 << 20, 'x');
+
+    BENCHMARK_ADVANCED("Resultado<std::vector<char>>: Consumir() & (copia)")(Catch::Benchmark::Chronometer medidor) {
+        std::vector<res::Resultado<std::vector<char>>> rs;
+        rs.reserve(medidor.runs());
+        for (int i = 0; i < medidor.runs(); ++i) rs.emplace_back(carga);
+        medidor.measure([&](int i) { return std::get<0>(rs[i].Consumir()).size(); });
+    };
+    BENCHMARK_ADVANCED("Resultado<std::vector<char>>: Consumir() && (movimiento)")(Catch::Benchmark::Chronometer medidor) {
+        std::vector<res::Resultado<std::vector<char>>> rs;
+        rs.reserve(medidor.runs());
+        for (int i = 0; i < medidor.runs(); ++i) rs.emplace_back(carga);
+        medidor.measure([&](int i) { return std::get<0>(std::move(rs[i]).Consumir()).size(); });
+    };
+    BENCHMARK_ADVANCED("Resultado<std::vector<char>>: Extraer()")(Catch::Benchmark::Chronometer medidor) {
+        std::vector<res::Resultado<std::vector<char>>> rs;
+        rs.reserve(medidor.runs());
+        for (int i = 0; i < medidor.runs(); ++i) rs.emplace_back(carga);
+        medidor.measure([&](int i) { return std::get<0>(rs[i].Extraer()).size(); });
+    };
+}
+
+/****************************************************************
+ *                 ACCESO PRESTADO VS. CONSUMIR                 *
+ ****************************************************************/
+
+TEST_CASE("Inspeccionar sin consumir", "[rendimiento][acceso]") {
+    res::Resultado<std::string> exitoso(std::string(64, 'x'));
+    res::Resultado<std::string> fallido(err::Generico(std::string(64, 'y')));
+
+    BENCHMARK("Consumir() y descartar (éxito)") {
+        return std::get<0>(exitoso.Consumir()).size();
+    };
+    BENCHMARK("si() (éxito)") {
+        const std::string* valor = exitoso.si();
+        return valor ? valor->size() : 0;
+    };
+    BENCHMARK("Consumir() y descartar (error)") {
+        return static_cast<bool>(std::get<1>(fallido.Consumir()));
+    };
+    BENCHMARK("Error() por referencia (error)") {
+        return static_cast<bool>(fallido.Error());
+    };
+}
+
+/****************************************************************
+ *                 COMBINADORES VS. CASCADA DE IF               *
+ ****************************************************************/
+
+TEST_CASE("Cadena de validación de 12 etapas", "[rendimiento][combinadores]") {
+    std::vector<int> entradas(1024);
+    for (std::size_t i = 0; i < entradas.size(); ++i) {
+        entradas[i] = static_cast<int>(i * 2'039) - 1'000;
+    }
+
+    BENCHMARK("Combinadores (mapear / yLuego / oSino / transformarError)") {
+        int suma = 0;
+        for (int x : entradas) {
+            auto r = validacion::encadenado(x);
+            suma += r ? r.Valor() : static_cast<int>(r.Error());
+        }
+        return suma;
+    };
+    BENCHMARK("Cascada de if") {
+        int suma = 0;
+        for (int x : entradas) {
+            auto r = validacion::cascada(x);
+            suma += r ? r.Valor() : static_cast<int>(r.Error());
+        }
+        return suma;
+    };
+    BENCHMARK("Consumir() en cada etapa") {
+        int suma = 0;
+        for (int x : entradas) {
+            auto [a, e1] = validacion::noNegativo(x)();
+            if (e1 != validacion::Fallo::NINGUNO) { suma += static_cast<int>(e1); continue; }
+            auto [b, e2] = validacion::acotado(a * 2)();
+            if (e2 != validacion::Fallo::NINGUNO) { suma += static_cast<int>(e2); continue; }
+            auto [c, e3] = validacion::noMultiploDeSiete(b + 7)();
+            if (e3 != validacion::Fallo::NINGUNO) { suma += static_cast<int>(e3); continue; }
+            auto [d, e4] = validacion::enRango(c / 3)();
+            int v = e4 != validacion::Fallo::NINGUNO ? 10 : d - 1;
+            auto [f, e5] = validacion::par(v & ~1)();
+            suma += e5 != validacion::Fallo::NINGUNO ? static_cast<int>(validacion::Fallo::FUERA_DE_RANGO) : f;
+        }
+        return suma;
+    };
+}
+
+/****************************************************************
+ *          PROPAGACIÓN: CORRUTINAS VS. DESEMPAQUE MANUAL       *
+ ****************************************************************/
+
+namespace {
+    constexpr int CAPAS = 8;
+
+    res::Resultado<int> hoja(int x) {
+        if (x < 0) return res::Resultado<int>(err::Generico("negativo"));
+        return res::Resultado<int>(x);
+    }
+
+    // Cada capa desempaca la tupla y reenvía el error.
+    template<int N>
+    res::Resultado<int> manual(int x) {
+        if constexpr (N == 0) {
+            return hoja(x);
+        } else {
+            auto [v, e] = manual<N - 1>(x)();
+            if (e) return res::Resultado<int>(e);
+            return res::Resultado<int>(v + 1);
+        }
+    }
+
+    template<int N>
+    res::Resultado<int> corrutina(int x) {
+        if constexpr (N == 0) {
+            co_return co_await hoja(x);
+        } else {
+            int v = co_await corrutina<N - 1>(x);
+            co_return v + 1;
+        }
+    }
+}
+
+TEST_CASE("Propagación a través de 8 capas", "[rendimiento][corrutinas]") {
+    BENCHMARK("Desempaque manual (éxito)") {
+        return manual<CAPAS>(1).Valor();
+    };
+    BENCHMARK("co_await (éxito)") {
+        return corrutina<CAPAS>(1).Valor();
+    };
+    BENCHMARK("Desempaque manual (error)") {
+        return static_cast<bool>(manual<CAPAS>(-1));
+    };
+    BENCHMARK("co_await (error)") {
+        return static_cast<bool>(corrutina<CAPAS>(-1));
+    };
+}
+
+/****************************************************************
+ *              ASINCRONÍA: RESULTADOASYNC VS. FUTURE           *
+ ****************************************************************/
+
+TEST_CASE("Completar y encadenar 3 etapas", "[rendimiento][asincronia]") {
+    BENCHMARK("ResultadoAsync: luego x3, luego completar") {
+        res::PromesaAsync<int> promesa;
+        auto final = promesa.obtenerResultado()
+            .luego([](int v) { return v + 1; })
+            .luego([](int v) { return v * 2; })
+            .luego([](int v) { return v - 3; });
+        promesa.cumplir(1);
+        return std::move(final).esperar().Valor();
+    };
+    BENCHMARK("std::promise/std::future: 3 etapas con get()") {
+        std::promise<int> p1, p2, p3, p4;
+        auto f1 = p1.get_future(), f2 = p2.get_future(), f3 = p3.get_future(), f4 = p4.get_future();
+        p1.set_value(1);
+        p2.set_value(f1.get() + 1);
+        p3.set_value(f2.get() * 2);
+        p4.set_value(f3.get() - 3);
+        return f4.get();
+    };
+}
+
+/****************************************************************
+ *            GRUPO DE HILOS: ESCALADO DE 1 A N HILOS           *
+ ****************************************************************/
+
+namespace {
+    constexpr int TAREAS = 64;
+
+    // Trabajo de CPU puro, proporcional a `pasos`.
+    res::Resultado<int> trabajo(int semilla, int pasos) {
+        unsigned x = static_cast<unsigned>(semilla) + 1;
+        for (int i = 0; i < pasos; ++i) {
+            x = x * 1664525u + 1013904223u;
+        }
+        return res::Resultado<int>(static_cast<int>(x >> 16));
+    }
+
+    // Cada tarea cuesta lo mismo, o una de cada 16 cuesta 16 veces más (mismo total).
+    int lote(res::GrupoHilos& grupo, bool sesgado) {
+        res::LoteTareas<int> tareas(grupo);
+        for (int i = 0; i < TAREAS; ++i) {
+            int pasos = !sesgado ? 2'000 : (i % 16 == 0 ? 16'000 : 1'000);
+            tareas.lanzar([i, pasos]() { return trabajo(i, pasos); });
+        }
+        int suma = 0;
+        for (auto& resultado : tareas.esperar().resultados) {
+            suma += resultado.Valor();
+        }
+        return suma;
+    }
+}
+
+TEST_CASE("LoteTareas: escalado con la cantidad de hilos", "[rendimiento][hilos]") {
+    std::size_t maximo = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t hilos = 1; hilos <= maximo; hilos *= 2) {
+        res::GrupoHilos grupo(hilos);
+        BENCHMARK("Uniforme, " + std::to_string(hilos) + " hilo(s)") {
+            return lote(grupo, false);
+        };
+        BENCHMARK("Sesgado, " + std::to_string(hilos) + " hilo(s)") {
+            return lote(grupo, true);
+        };
+    }
+}
+
+/****************************************************************
+ *          RECOLECCIÓN: SECUENCIAL VS. PARALELA                *
+ * ------------------------------------------------------------ *
+ *   Se usa `Resultado<int, Fallo>` (8 bytes): con `err::Error` *
+ *   cada elemento ocupa más de 100 bytes y 100M no entran en   *
+ *   memoria.                                                   *
+ ****************************************************************/
+
+TEST_CASE("recolectar y particionar: de 1K a 100M elementos", "[rendimiento][recoleccion]") {
+    using ResultadoEntero = res::Resultado<int, validacion::Fallo>;
+    res::GrupoHilos grupo;
+    for (std::size_t cantidad = 1'000; cantidad <= 100'000'000; cantidad *= 10) {
+        std::vector<ResultadoEntero> resultados;
+        resultados.reserve(cantidad);
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            resultados.emplace_back(static_cast<int>(i));
+        }
+        // Un error de cada 64 para particionar.
+        std::vector<ResultadoEntero> mezclados;
+        mezclados.reserve(cantidad);
+        for (std::size_t i = 0; i < cantidad; ++i) {
+            mezclados.push_back(i % 64 == 63 ? ResultadoEntero(res::en_error, validacion::Fallo::IMPAR) : ResultadoEntero(static_cast<int>(i)));
+        }
+
+        std::string sufijo = ", " + std::to_string(cantidad) + " elementos";
+        BENCHMARK_ADVANCED("recolectar secuencial" + sufijo)(Catch::Benchmark::Chronometer medidor) {
+            medidor.measure([&](int) { return res::recolectar(resultados).Valor().size(); });
+        };
+        BENCHMARK_ADVANCED("recolectar paralelo" + sufijo)(Catch::Benchmark::Chronometer medidor) {
+            medidor.measure([&](int) { return res::recolectar(resultados, grupo).Valor().size(); });
+        };
+        BENCHMARK_ADVANCED("particionar secuencial" + sufijo)(Catch::Benchmark::Chronometer medidor) {
+            medidor.measure([&](int) { return res::particionar(mezclados).errores.size(); });
+        };
+        BENCHMARK_ADVANCED("particionar paralelo" + sufijo)(Catch::Benchmark::Chronometer medidor) {
+            medidor.measure([&](int) { return res::particionar(mezclados, grupo).errores.size(); });
+        };
+    }
+}
+
+/****************************************************************
+ *          OPCIÓN COLUMNAR: OPCIONLOTE VS. VECTOR<OPCION>      *
+ ****************************************************************/
+
+TEST_CASE("OpcionLote<double> vs. std::vector<Opcion<double>>, 1M elementos", "[rendimiento][opcion][lote]") {
+    constexpr std::size_t CANTIDAD = 1'000'000;
+    std::vector<opc::Opcion<double>> opciones;
+    opciones.reserve(CANTIDAD);
+    for (std::size_t i = 0; i < CANTIDAD; ++i) {
+        opciones.push_back(i % 10 == 0 ? opc::Opcion<double>() : opc::Opcion<double>(static_cast<double>(i)));
+    }
+    opc::OpcionLote<double> lote(opciones);
+
+    SECTION("Memoria: sizeof(T) más un bit por elemento") {
+        std::size_t bytesOpciones = opciones.size() * sizeof(opc::Opcion<double>);
+        std::size_t bytesLote = lote.datos().size() * sizeof(double) + lote.mapa().datos().size() * sizeof(std::uint64_t);
+        REQUIRE(bytesLote <= CANTIDAD * sizeof(double) + CANTIDAD / 8 + 8);
+        REQUIRE(bytesLote * 16 < bytesOpciones * 9);
+    }
+
+    BENCHMARK("vector<Opcion>: contar presentes") {
+        std::size_t presentes = 0;
+        for (const auto& opcion : opciones) presentes += !opcion.estaVacia();
+        return presentes;
+    };
+    BENCHMARK("OpcionLote: contarPresentes") {
+        return lote.contarPresentes();
+    };
+    BENCHMARK("vector<Opcion>: valorO en cada elemento") {
+        std::vector<double> salida;
+        salida.reserve(opciones.size());
+        for (const auto& opcion : opciones) salida.push_back(opcion.valorO(0.0));
+        return salida.size();
+    };
+    BENCHMARK("OpcionLote: valorO en lote") {
+        return lote.valorO(0.0).size();
+    };
+    BENCHMARK("vector<Opcion>: suma de presentes") {
+        double suma = 0;
+        for (const auto& opcion : opciones) if (const double* v = opcion.si()) suma += *v;
+        return suma;
+    };
+    BENCHMARK("OpcionLote: suma con paraCadaPresente") {
+        double suma = 0;
+        lote.paraCadaPresente([&](std::size_t, double v) { suma += v; });
+        return suma;
+    };
+}
+
+/****************************************************************
+ *        RESULTADO COLUMNAR: RESULTADOLOTE VS. VECTOR          *
+ ****************************************************************/
+
+TEST_CASE("ResultadoLote<int> vs. std::vector<Resultado<int>>, 1M elementos", "[rendimiento][resultado][lote]") {
+    constexpr int CANTIDAD = 1'000'000;
+    // Validación con un error cada 1000 elementos.
+    auto validar = [](int i) {
+        return i % 1000 == 999 ? res::Resultado<int>(err::Generico("fuera de rango")) : res::Resultado<int>(i);
+    };
+
+    SECTION("Memoria: sizeof(T) más un bit por éxito") {
+        res::ResultadoLote<int> lote;
+        lote.reservar(CANTIDAD);
+        for (int i = 0; i < CANTIDAD; ++i) lote.agregar(validar(i));
+        std::size_t bytesExitos = lote.datos().capacity() * sizeof(int) + lote.mapa().datos().capacity() * sizeof(std::uint64_t);
+        REQUIRE(bytesExitos <= CANTIDAD * sizeof(int) + CANTIDAD / 8 + 8);
+        REQUIRE(lote.errores().size() == CANTIDAD / 1000);
+    }
+
+    BENCHMARK_ADVANCED("vector<Resultado>: validar y contar fallos")(Catch::Benchmark::Chronometer medidor) {
+        medidor.measure([&](int) {
+            std::vector<res::Resultado<int>> resultados;
+            resultados.reserve(CANTIDAD);
+            for (int i = 0; i < CANTIDAD; ++i) resultados.push_back(validar(i));
+            std::size_t fallos = 0;
+            for (const auto& resultado : resultados) fallos += !resultado;
+            return fallos;
+        });
+    };
+    BENCHMARK_ADVANCED("ResultadoLote: validar y contar fallos")(Catch::Benchmark::Chronometer medidor) {
+        medidor.measure([&](int) {
+            res::ResultadoLote<int> lote;
+            lote.reservar(CANTIDAD);
+            for (int i = 0; i < CANTIDAD; ++i) lote.agregar(validar(i));
+            std::size_t fallos = 0;
+            lote.paraCadaFallo([&](std::size_t, const err::Error&) { ++fallos; });
+            return fallos;
+        });
+    };
+}
+
+/****************************************************************
+ *          ENTREGA ENTRE HILOS: OPCIONATOMICA VS. MUTEX        *
+ ****************************************************************/
+
+namespace {
+    struct Configuracion {
+        int version;
+        explicit Configuracion(int v) : version(v) {}
+    };
+
+    // Lo que se usa hoy: la ranura envuelta en un mutex.
+    class RanuraConMutex {
+        public:
+        ~RanuraConMutex() { delete valor; }
+        void publicar(Configuracion* nuevo) {
+            Configuracion* anterior;
+            {
+                std::lock_guard bloqueo(cerrojo);
+                anterior = std::exchange(valor, nuevo);
+            }
+            delete anterior;
+        }
+        Configuracion* tomar() {
+            std::lock_guard bloqueo(cerrojo);
+            return std::exchange(valor, nullptr);
+        }
+
+        private:
+        std::mutex cerrojo;
+        Configuracion* valor = nullptr;
+    };
+
+    // Un hilo publica y `lectores` hilos toman, cada uno `OPERACIONES` veces.
+    constexpr int OPERACIONES = 10'000;
+
+    template<typename Publicar, typename Tomar>
+    int entregar(int lectores, Publicar publicar, Tomar tomar) {
+        std::atomic<int> tomadas{0};
+        std::vector<std::thread> hilos;
+        for (int l = 0; l < lectores; ++l) {
+            hilos.emplace_back([&] {
+                int propias = 0;
+                for (int i = 0; i < OPERACIONES; ++i) propias += tomar();
+                tomadas += propias;
+            });
+        }
+        for (int i = 0; i < OPERACIONES; ++i) publicar(i);
+        for (auto& hilo : hilos) hilo.join();
+        return tomadas;
+    }
+}
+
+TEST_CASE("OpcionAtomica vs. mutex: publicar y tomar con contención", "[rendimiento][opcion][hilos]") {
+    for (int lectores : {1, 3}) {
+        std::string sufijo = ", " + std::to_string(lectores) + " lector(es)";
+        BENCHMARK_ADVANCED("Mutex" + sufijo)(Catch::Benchmark::Chronometer medidor) {
+            medidor.measure([&](int) {
+                RanuraConMutex ranura;
+                return entregar(lectores,
+                    [&](int i) { ranura.publicar(new Configuracion(i)); },
+                    [&]() { Configuracion* c = ranura.tomar(); delete c; return c != nullptr ? 1 : 0; });
+            });
+        };
+        BENCHMARK_ADVANCED("OpcionAtomica" + sufijo)(Catch::Benchmark::Chronometer medidor) {
+            medidor.measure([&](int) {
+                opc::OpcionAtomica<Configuracion*> ranura;
+                return entregar(lectores,
+                    [&](int i) { ranura.publicar(new Configuracion(i)); },
+                    [&]() { return ranura.tomar().estaVacia() ? 0 : 1; });
+            });
+        };
+    }
+}
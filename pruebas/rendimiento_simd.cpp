@@ -0,0 +1,91 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "errores--.hpp"
+
+/****************************************************************
+ *                NÚCLEOS VECTORIALES (SIMD)                    *
+ * ------------------------------------------------------------ *
+ *   Cada núcleo de `Simd.hpp` en sus versiones escalar, SSE2   *
+ *   y AVX2 (las que soporte el procesador), sobre 1M de        *
+ *   elementos con la mitad presentes al azar. Se ejecutan con: *
+ *       correr_rendimiento_simd "[simd]"                       *
+ ***************************************************************/
+
+namespace {
+    constexpr std::size_t CANTIDAD = 1'000'000;
+
+    const char* nombreNivel(simd::Nivel nivel) {
+        switch (nivel) {
+            case simd::Nivel::AVX2: return "AVX2";
+            case simd::Nivel::SSE2: return "SSE2";
+            default: return "escalar";
+        }
+    }
+
+    std::vector<simd::Nivel> nivelesDisponibles() {
+        std::vector<simd::Nivel> niveles{simd::Nivel::ESCALAR};
+        if (simd::nivelDisponible() >= simd::Nivel::SSE2) niveles.push_back(simd::Nivel::SSE2);
+        if (simd::nivelDisponible() >= simd::Nivel::AVX2) niveles.push_back(simd::Nivel::AVX2);
+        return niveles;
+    }
+
+    // Mitad de los bits en uno, sin patrón que el predictor de saltos pueda aprender.
+    std::vector<std::uint64_t> mapaAleatorio(std::size_t elementos) {
+        std::vector<std::uint64_t> mapa((elementos + 63) / 64);
+        std::uint64_t estado = 0x9E3779B97F4A7C15u;
+        for (auto& palabra : mapa) {
+            estado ^= estado << 13; estado ^= estado >> 7; estado ^= estado << 17;
+            palabra = estado;
+        }
+        return mapa;
+    }
+
+    template<typename T>
+    void medirTipo(const char* tipo) {
+        std::vector<T> datos(CANTIDAD);
+        for (std::size_t i = 0; i < CANTIDAD; ++i) datos[i] = static_cast<T>(i);
+        const auto mapa = mapaAleatorio(CANTIDAD);
+        std::vector<T> destino(CANTIDAD);
+
+        for (auto nivel : nivelesDisponibles()) {
+            std::string sufijo = std::string(", ") + tipo + ", " + nombreNivel(nivel);
+            BENCHMARK("compactar" + sufijo) {
+                return simd::compactar(nivel, datos.data(), mapa.data(), CANTIDAD, destino.data());
+            };
+            BENCHMARK("rellenar" + sufijo) {
+                simd::rellenar(nivel, datos.data(), mapa.data(), CANTIDAD, T(0));
+                return datos[0];
+            };
+        }
+    }
+}
+
+TEST_CASE("contarBits y combinarMapas", "[simd]") {
+    const auto a = mapaAleatorio(CANTIDAD);
+    auto b = mapaAleatorio(CANTIDAD + 64);
+    b.erase(b.begin());
+    auto c = mapaAleatorio(CANTIDAD + 128);
+    c.erase(c.begin(), c.begin() + 2);
+    const std::uint64_t* columnas[] = {a.data(), b.data(), c.data()};
+    std::vector<std::uint64_t> validas(a.size());
+
+    for (auto nivel : nivelesDisponibles()) {
+        BENCHMARK(std::string("contarBits, ") + nombreNivel(nivel)) {
+            return simd::contarBits(nivel, a.data(), a.size());
+        };
+        BENCHMARK(std::string("combinarMapas de 3 columnas, ") + nombreNivel(nivel)) {
+            simd::combinarMapas(nivel, validas.data(), columnas, 3, validas.size());
+            return validas[0];
+        };
+    }
+}
+
+TEST_CASE("compactar y rellenar por tipo", "[simd]") {
+    medirTipo<std::int32_t>("int32");
+    medirTipo<std::int64_t>("int64");
+    medirTipo<float>("float");
+    medirTipo<double>("double");
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include "errores--.hpp"
+
+/****************************************************************
+ *                  TRAZAS DE LOS ERRORES                       *
+ * ------------------------------------------------------------ *
+ *   El costo de capturar la pila al crear un error, por        *
+ *   severidad y política. Se compila con `ERRORES_TRAZA=2`     *
+ *   (todas las políticas disponibles). Se ejecuta con:         *
+ *       correr_rendimiento_traza "[traza]"                     *
+ ***************************************************************/
+
+namespace {
+    // Ocho llamadas de profundidad, para que la pila no sea trivial.
+    template<int N>
+    err::Error crearEnProfundidad(err::CodigoEstado codigo) {
+        if constexpr (N == 0) {
+            return err::Error(codigo, "Fallo en lo profundo");
+        } else {
+            err::Error e = crearEnProfundidad<N - 1>(codigo);
+            return e;
+        }
+    }
+
+    const char* nombrePolitica(err::traza::Politica politica) {
+        switch (politica) {
+            case err::traza::Politica::TODOS: return "todos";
+            case err::traza::Politica::FATALES: return "sólo fatales";
+            default: return "nunca";
+        }
+    }
+}
+
+TEST_CASE("Capturar la traza al crear errores", "[rendimiento][traza]") {
+    using err::traza::Politica;
+    const Politica inicial = err::traza::politica();
+    for (Politica politica : {Politica::NUNCA, Politica::FATALES, Politica::TODOS}) {
+        err::traza::establecerPolitica(politica);
+        const std::string sufijo = std::string(", política: ") + nombrePolitica(politica);
+
+        BENCHMARK(std::string("ERROR") + sufijo) {
+            return crearEnProfundidad<8>(err::ERROR).Pila().tamano();
+        };
+        BENCHMARK(std::string("FATAL") + sufijo) {
+            return crearEnProfundidad<8>(err::FATAL).Pila().tamano();
+        };
+        BENCHMARK(std::string("EXITO") + sufijo) {
+            return crearEnProfundidad<8>(err::EXITO).Pila().tamano();
+        };
+    }
+
+    err::traza::establecerPolitica(Politica::FATALES);
+    BENCHMARK("FATAL + Mensaje() (resolución de símbolos)") {
+        return crearEnProfundidad<8>(err::FATAL).Mensaje().size();
+    };
+    err::traza::establecerPolitica(inicial);
+}
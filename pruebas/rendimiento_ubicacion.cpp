@@ -0,0 +1,54 @@
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <vector>
+#include "errores--.hpp"
+
+/****************************************************************
+ *                 UBICACIÓN DE LOS ERRORES                     *
+ * ------------------------------------------------------------ *
+ *   El costo de registrar dónde se crea cada `Error`. Se       *
+ *   compila dos veces: `correr_rendimiento_ubicacion` lo       *
+ *   registra y `correr_rendimiento_sin_ubicacion` define       *
+ *   `ERRORES_SIN_UBICACION`. Se ejecutan con:                  *
+ *       correr_rendimiento_ubicacion "[ubicacion]"             *
+ *       correr_rendimiento_sin_ubicacion "[ubicacion]"         *
+ ***************************************************************/
+
+namespace {
+#ifndef ERRORES_SIN_UBICACION
+    const std::string CONFIGURACION = " (con ubicación)";
+#else
+    const std::string CONFIGURACION = " (sin ubicación)";
+#endif
+
+    constexpr int CANTIDAD = 1000;
+
+    // Construye `CANTIDAD` errores en un vector ya reservado, como una validación masiva.
+    template<typename Crear>
+    std::size_t construir(std::vector<err::Error>& destino, Crear crear) {
+        destino.clear();
+        for (int i = 0; i < CANTIDAD; ++i) {
+            destino.push_back(crear(i));
+        }
+        return destino.size();
+    }
+}
+
+TEST_CASE("Construir errores con y sin ubicación", "[rendimiento][ubicacion]") {
+    std::vector<err::Error> errores;
+    errores.reserve(CANTIDAD);
+
+    BENCHMARK("1000 errores literales" + CONFIGURACION) {
+        return construir(errores, [](int) { return err::Generico("Solicitud rechazada por exceder el límite de tasa"); });
+    };
+    BENCHMARK("1000 errores de catálogo" + CONFIGURACION) {
+        return construir(errores, [](int) { return err::Fatal(); });
+    };
+    BENCHMARK("1000 errores con dominio" + CONFIGURACION) {
+        return construir(errores, [](int i) { return err::Error(err::ERROR, err::dominios::SISTEMA, i, "Fallo del sistema"); });
+    };
+    BENCHMARK("1000 errores dinámicos" + CONFIGURACION) {
+        return construir(errores, [](int) { return err::Generico(std::string("Solicitud rechazada por exceder el límite de tasa")); });
+    };
+}